@@ -6,6 +6,10 @@
 #include "pch.h"
 #include "GameApplication.h"
 #include <MainFrame.h>
+#include <ImageCache.h>
+#include <GraphicsBitmapCache.h>
+#include <GraphicsResourceCache.h>
+#include <wx/progdlg.h>
 
 #ifdef _WIN32
 #define _CRTDBG_MAP_ALLOC
@@ -30,9 +34,34 @@ bool GameApplication::OnInit()
     // Add image type handlers
     wxInitAllImageHandlers();
 
+    // Decode every game image in parallel while a splash shows how far along it is
+    {
+        wxProgressDialog splash(L"SpartyBoots", L"Loading images...", 100, nullptr, wxPD_AUTO_HIDE | wxPD_SMOOTH);
+        ImageCache::Preload(L"resources/images/", [&splash](size_t done, size_t total)
+        {
+            splash.Update(int(done * 100 / total));
+        });
+    }
+
     auto frame = new MainFrame();
     frame->Initialize();
     frame->Show(true);
 
     return true;
 }
+
+/**
+ * Clean up as the application exits.
+ *
+ * The caches hold native objects made by the graphics renderers and
+ * bitmaps, which have to be released before wxWidgets shuts down.
+ * @return Exit code
+ */
+int GameApplication::OnExit()
+{
+    GraphicsBitmapCache::Clear();
+    GraphicsResourceCache::Clear();
+    ImageCache::Clear();
+
+    return wxApp::OnExit();
+}
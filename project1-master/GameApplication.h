@@ -16,6 +16,7 @@ class GameApplication : public wxApp
 {
 public:
     bool OnInit() override;
+    int OnExit() override;
 };
 
 
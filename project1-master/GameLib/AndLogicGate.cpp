@@ -6,6 +6,8 @@
 
 #include "pch.h"
 #include "AndLogicGate.h"
+#include "Game.h"
+#include "RenderList.h"
 
 /**
  * @brief Size of the AND gate in pixels.
@@ -33,18 +35,19 @@ AndLogicGate::AndLogicGate(Game* game): LogicGate(game)
     const wxPoint InputPinLocation2(x - w / 1.3, y - h / 4.5);
     const wxPoint OutputPinLocation1(x + w / 1.25, y);
 
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation1));
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation2));
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation1));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation1));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation2));
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation1));
 }
 
 /**
- * @brief Draws the AND logic gate.
+ * @brief Records the AND logic gate.
  *
- * This function creates and draws the shape of the AND gate on the given
- * graphics context using Bezier curves.
+ * This function records the shape of the AND gate as a path made of
+ * lines and a semicircle.
+ * @param list The render list to record into
  */
-void AndLogicGate::Draw(wxGraphicsContext* gc)
+void AndLogicGate::Record(RenderList* list)
 {
     // The location and size of the gate
     auto x = GetX();
@@ -52,48 +55,26 @@ void AndLogicGate::Draw(wxGraphicsContext* gc)
     auto w = GetWidth();
     auto h = GetHeight();
 
-    // Create a path to draw the gate shape
-    auto path = gc->CreatePath();
-
     // Define the points for the rectangular part of the AND gate
     wxPoint2DDouble p1(x - w / 2, y + h / 2); // Bottom left
     wxPoint2DDouble p2(x + w / 4, y + h / 2); // Bottom right (before curve)
     wxPoint2DDouble p4(x - w / 2, y - h / 2); // Top left
 
-    // Create the path for the AND gate
-    path.MoveToPoint(p1);
-    path.AddLineToPoint(p2);
-
-    // Create a semicircle to the right side of the gate
-    path.AddArc(x + w / 4, y, h / 2, M_PI / 2, -M_PI / 2, false);
-
-    path.AddLineToPoint(p4);
-    path.CloseSubpath();
-
     // Draw pins first
-    DrawPins(gc);
-
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxBLACK_BRUSH);
-
-    // Bottom input
-    //gc->StrokeLine((x - w / 3), (y + h / 4.5), (x - w / 1.5), (y + h / 4.5));
-    //gc->DrawEllipse((x - w / 1.3), ((-h / 20) + y + h / 4.5), h / 10, h / 10);
+    RecordPins(list);
 
-    // Top input
-    //gc->StrokeLine((x - w / 3), (y - h / 4.5), (x - w / 1.5), (y - h / 4.5));
-    //gc->DrawEllipse((x - w / 1.3), ((-h / 20) + y - h / 4.5), h / 10, h / 10);
+    // Create the path for the AND gate
+    list->MoveTo(p1);
+    list->LineTo(p2);
 
-    // Middle output
-    //gc->StrokeLine((x + w / 3), (y), (x + w / 1.5), (y));
-    //gc->DrawEllipse((x + w / 1.5), ((-h / 20) + y), h / 10, h / 10);
+    // Create a semicircle to the right side of the gate
+    list->Arc(x + w / 4, y, h / 2, M_PI / 2, -M_PI / 2, false);
 
-    // Set pen and brush for drawing the gate
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxWHITE_BRUSH);
+    list->LineTo(p4);
+    list->ClosePath();
 
     // Draw the AND gate shape
-    gc->DrawPath(path);
+    list->FillPath(*wxBLACK, *wxWHITE);
 }
 
 /**
@@ -102,11 +83,11 @@ void AndLogicGate::Draw(wxGraphicsContext* gc)
 void AndLogicGate::ComputeOutput()
 {
     // Get input pins
-    auto inputPin1 = GetPinInputs()[0];
-    auto inputPin2 = GetPinInputs()[1];
+    auto& inputPin1 = GetPinInputs()[0];
+    auto& inputPin2 = GetPinInputs()[1];
 
     // Get output pins
-    auto outputPin = GetOutputPins()[0];
+    auto& outputPin = GetOutputPins()[0];
 
     // Calculate state and set the output pin state
     if (inputPin1->GetState() == State::One && inputPin2->GetState() == State::One)
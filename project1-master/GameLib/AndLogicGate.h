@@ -42,11 +42,11 @@ public:
     void operator=(const AndLogicGate&) = delete;
 
     /**
-     * @brief Draw the AND Logic Gate.
+     * @brief Record the AND Logic Gate.
      *
-     * @param gc Pointer to the wxGraphicsContext used for drawing.
+     * @param list The render list to record into.
      */
-    void Draw(wxGraphicsContext* gc) override;
+    void Record(RenderList* list) override;
     void ComputeOutput() override;
 
     /**
@@ -5,6 +5,7 @@
 
 #include "pch.h"
 #include "Banner.h"
+#include "GraphicsResourceCache.h"
 
 using namespace std;
 
@@ -46,8 +47,8 @@ void Banner::Draw(wxGraphicsContext* graphics)
     if (mVisible)
     {
         // Set the brush and pen for the background rectangle
-        graphics->SetBrush(wxBrush(LevelNoticeBackground, wxBRUSHSTYLE_SOLID));
-        graphics->SetPen(wxPen(LevelNoticeBackground, 0, wxPENSTYLE_TRANSPARENT));
+        graphics->SetBrush(GraphicsResourceCache::GetBrush(graphics, LevelNoticeBackground));
+        graphics->SetPen(GraphicsResourceCache::GetPen(graphics, LevelNoticeBackground, 0, wxPENSTYLE_TRANSPARENT));
 
         // Figure out the location to draw the text
         // Cut the width into quarters
@@ -61,8 +62,7 @@ void Banner::Draw(wxGraphicsContext* graphics)
                                 NoticeSize + LevelNoticePadding + 10);
 
         // Set the font and font size
-        auto font = graphics->CreateFont(NoticeSize, L"Arial", wxFONTFLAG_BOLD, LevelNoticeColor);
-        graphics->SetFont(font);
+        graphics->SetFont(GraphicsResourceCache::GetFont(graphics, NoticeSize, L"Arial", wxFONTFLAG_BOLD, LevelNoticeColor));
         graphics->DrawText(mText, centerX, centerY);
     }
 }
@@ -80,9 +80,26 @@ void Banner::Update(double elapsed)
     if (mTime >= 0)
     {
         mTime += elapsed;
-        if (mTime >= LevelNoticeDuration)
+        if (mTime >= LevelNoticeDuration && mVisible)
         {
             mVisible = false;
+            Invalidate();
         }
     }
 }
+
+/**
+ * Get the area the banner draws over, with room
+ * around the background for the text
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Banner::GetBounds()
+{
+    double centerX = mLevelWidth * 0.25;
+    int centerY = (mLevelHeight / 2) - (NoticeSize / 2);
+
+    wxRect2DDouble bounds(centerX - LevelNoticePadding, centerY - (LevelNoticePadding / 2),
+                          LevelNoticeWidth, NoticeSize + LevelNoticePadding + 10);
+    bounds.Inset(-LevelNoticePadding, -LevelNoticePadding);
+    return bounds;
+}
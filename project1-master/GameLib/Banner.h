@@ -28,6 +28,7 @@ public:
     void Draw(wxGraphicsContext* graphics) override;
 
     void Update(double elapsed) override;
+    wxRect2DDouble GetBounds() override;
 
     /// Default constructor (disabled)
     Banner() = delete;
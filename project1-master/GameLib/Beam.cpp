@@ -8,6 +8,8 @@
 #include "BeamDetectionVisitor.h"
 
 #include "OutputLogicGate.h"
+#include "ImageCache.h"
+#include "RenderList.h"
 
 /// Image directory
 const std::wstring DirectoryContainingImages = L"resources/images/";
@@ -22,6 +24,18 @@ const std::wstring BeamGreenImage = DirectoryContainingImages + L"beam-green.png
 /// This is larger than normal to get it past Sparty's feet
 const int BeamPinOffset = 80;
 
+/// Colour of the glow around the laser
+const wxColour LaserOuterColor(255, 200, 200, 100);
+
+/// Width of the glow around the laser in pixels
+const int LaserOuterWidth = 8;
+
+/// Colour of the core of the laser
+const wxColour LaserInnerColor(255, 0, 0, 175);
+
+/// Width of the core of the laser in pixels
+const int LaserInnerWidth = 4;
+
 /**
  * Constructor for Beam
  *
@@ -31,12 +45,12 @@ const int BeamPinOffset = 80;
 Beam::Beam(Game* game, int senderOffset)
     : Item(game, BeamGreenImage), mSenderOffset(senderOffset), mOutputPinVal(0)
 {
-    mSenderBitmap = std::make_unique<wxBitmap>(BeamGreenImage, wxBITMAP_TYPE_ANY);
+    // Every state's images are decoded and mirrored once and shared between beams
+    mSenderGreenBitmap = ImageCache::GetBitmap(BeamGreenImage);
+    mReceiverGreenBitmap = ImageCache::GetMirroredBitmap(BeamGreenImage);
+    mSenderRedBitmap = ImageCache::GetBitmap(BeamRedImage);
+    mReceiverRedBitmap = ImageCache::GetMirroredBitmap(BeamRedImage);
 
-    // Mirror the reciever
-    wxImage receiverImage(BeamGreenImage, wxBITMAP_TYPE_ANY);
-    receiverImage = receiverImage.Mirror();
-    mReceiverBitmap = std::make_unique<wxBitmap>(receiverImage);
     mOutputPin = std::make_unique<OutputLogicGate>(game);
     game->Add(mOutputPin);
     mOutputPin->SetOutputState(State::Zero);
@@ -48,6 +62,18 @@ Beam::Beam(Game* game, int senderOffset)
  * @param graphics The graphics context to draw on.
  */
 void Beam::Draw(wxGraphicsContext* graphics)
+{
+    RenderList list;
+    Record(&list);
+    list.Replay(graphics);
+}
+
+/**
+ * Records the commands that draw the beam.
+ *
+ * @param list The render list to record into.
+ */
+void Beam::Record(RenderList* list)
 {
     /// Define colors for the active and inactive line states
     wxColour activeColor = wxColour(255, 0, 0);   // Red for active state
@@ -55,51 +81,60 @@ void Beam::Draw(wxGraphicsContext* graphics)
     int lineWidth = 3;  ///< Line width to match the output pin's style
     int pinRadius = 5;  ///< Adjust this value if the pin circle is larger or smaller
 
-    // Calculate positions
-    int senderX = GetX() + mSenderOffset - mSenderBitmap->GetWidth() / 2;
-    int senderY = GetY() - mSenderBitmap->GetHeight() / 2;
-    int receiverX = GetX() - mReceiverBitmap->GetWidth() / 2;
-    int receiverY = GetY() - mReceiverBitmap->GetHeight() / 2;
-
-    // Beam line colors
-    wxPen laser1(wxColour(255, 200, 200, 100), 8);
-    wxPen laser2(wxColour(255, 0, 0, 175), 4);
-
-    // Get middle of the sender/reciever so the beam is centered
-    int senderMiddleY = senderY + mSenderBitmap->GetHeight() / 2;
-    int receiverMiddleY = receiverY + mReceiverBitmap->GetHeight() / 2;
+    // Pick the images for the current state
+    const auto& senderBitmap = (mOutputPinVal == 1) ? mSenderRedBitmap : mSenderGreenBitmap;
+    const auto& receiverBitmap = (mOutputPinVal == 1) ? mReceiverRedBitmap : mReceiverGreenBitmap;
 
-    //Draw the beams
-    graphics->SetPen(laser1);
-    graphics->StrokeLine(senderX + mSenderBitmap->GetWidth() / 2, senderMiddleY,
-                         receiverX + mReceiverBitmap->GetWidth() / 2, receiverMiddleY);
-
-    graphics->SetPen(laser2);
-    graphics->StrokeLine(senderX + mSenderBitmap->GetWidth() / 2, senderMiddleY,
-                         receiverX + mReceiverBitmap->GetWidth() / 2, receiverMiddleY);
+    // Calculate positions
+    int senderX = GetX() + mSenderOffset - senderBitmap->GetWidth() / 2;
+    int senderY = GetY() - senderBitmap->GetHeight() / 2;
+    int receiverX = GetX() - receiverBitmap->GetWidth() / 2;
+    int receiverY = GetY() - receiverBitmap->GetHeight() / 2;
 
+    // Get middle of the reciever so the pin wire is centered
+    int receiverMiddleY = receiverY + receiverBitmap->GetHeight() / 2;
 
+    // Draw the beams, over anything drawn before the beam such as products passing through it
+    double beamY = GetY();
+    list->StrokeLine(GetX() + mSenderOffset, beamY, GetX(), beamY, LaserOuterColor, LaserOuterWidth);
+    list->StrokeLine(GetX() + mSenderOffset, beamY, GetX(), beamY, LaserInnerColor, LaserInnerWidth);
 
     /// Determine color based on mOutputPinVal (1 for active, 0 for inactive)
     wxColour lineColor = (mOutputPinVal == 1) ? activeColor : inactiveColor;
 
     /// Calculate the x-coordinate for the start of the line, offset by the pin radius
-    int pinStartX = receiverX + mReceiverBitmap->GetWidth() / 2 + BeamPinOffset - pinRadius;
+    int pinStartX = receiverX + receiverBitmap->GetWidth() / 2 + BeamPinOffset - pinRadius;
     mOutputPin->SetLocation(pinStartX + pinRadius, receiverMiddleY);  // Set location of the pin center
 
     /// Draw the line from the receiver edge to just before the output pin circle
-    graphics->SetPen(wxPen(lineColor, lineWidth));
-    graphics->StrokeLine(receiverX + mReceiverBitmap->GetWidth() / 2, receiverMiddleY, pinStartX, receiverMiddleY);
+    list->StrokeLine(receiverX + receiverBitmap->GetWidth() / 2, receiverMiddleY, pinStartX, receiverMiddleY,
+                     lineColor, lineWidth);
 
     // Draw sender/recievers
-    graphics->DrawBitmap(*mSenderBitmap, senderX, senderY, mSenderBitmap->GetWidth(), mSenderBitmap->GetHeight());
-    graphics->DrawBitmap(*mReceiverBitmap, receiverX, receiverY, mReceiverBitmap->GetWidth(),
-                         mReceiverBitmap->GetHeight());
+    list->DrawBitmap(senderBitmap, senderX, senderY, senderBitmap->GetWidth(), senderBitmap->GetHeight());
+    list->DrawBitmap(receiverBitmap, receiverX, receiverY, receiverBitmap->GetWidth(), receiverBitmap->GetHeight());
 
 
 }
 
 
+
+
+/**
+ * Get the area the beam draws over: the sender, the receiver
+ * and the wire out to the output pin.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Beam::GetBounds()
+{
+    double width = mReceiverGreenBitmap->GetWidth();
+    double height = mReceiverGreenBitmap->GetHeight();
+
+    double left = GetX() + std::min(mSenderOffset, 0) - width / 2;
+    double right = GetX() + std::max(width / 2, double(BeamPinOffset));
+    return wxRect2DDouble(left, GetY() - height / 2, right - left, height);
+}
+
 /**
  * Detects if a product is breaking the beam and updates output state.
  * This is called after applying BeamDetectionVisitor.
@@ -111,28 +146,18 @@ void Beam::DetectProduct(bool productDetected)
     {
         if (mOutputPinVal == 0)  // Only update if not already active
         {
-            mOutputPinVal = 1;
-            // Change beam images to active state (red)
-            mSenderBitmap = std::make_unique<wxBitmap>(BeamRedImage, wxBITMAP_TYPE_ANY);
-
-            wxImage receiverImage(BeamRedImage, wxBITMAP_TYPE_ANY);
-            receiverImage = receiverImage.Mirror();
-            mReceiverBitmap = std::make_unique<wxBitmap>(receiverImage);
+            mOutputPinVal = 1;  // Draw switches to the red images
             mOutputPin->SetOutputState(State::One);
+            Invalidate();
         }
     }
     else
     {
         if (mOutputPinVal == 1)  // Only update if not already inactive
         {
-            mOutputPinVal = 0;
-            // Change beam images to inactive state (green)
-            mSenderBitmap = std::make_unique<wxBitmap>(BeamGreenImage, wxBITMAP_TYPE_ANY);
-
-            wxImage receiverImage(BeamGreenImage, wxBITMAP_TYPE_ANY);
-            receiverImage = receiverImage.Mirror();
-            mReceiverBitmap = std::make_unique<wxBitmap>(receiverImage);
+            mOutputPinVal = 0;  // Draw switches to the green images
             mOutputPin->SetOutputState(State::Zero);
+            Invalidate();
         }
     }
 }
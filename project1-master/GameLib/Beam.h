@@ -18,14 +18,18 @@ class Beam : public Item
 private:
     int mSenderOffset; ///< How much to the left to place the beamsender image
     int mOutputPinVal; ///< Keeps track of the state of output pin (0 or 1)
-    std::unique_ptr<wxBitmap> mSenderBitmap; ///< Bitmap for sender
-    std::unique_ptr<wxBitmap> mReceiverBitmap; ///< Bitmap for reciever
+    std::shared_ptr<wxBitmap> mSenderGreenBitmap; ///< Bitmap for sender when nothing breaks the beam
+    std::shared_ptr<wxBitmap> mReceiverGreenBitmap; ///< Mirrored bitmap for reciever when nothing breaks the beam
+    std::shared_ptr<wxBitmap> mSenderRedBitmap; ///< Bitmap for sender when a product breaks the beam
+    std::shared_ptr<wxBitmap> mReceiverRedBitmap; ///< Mirrored bitmap for reciever when a product breaks the beam
     std::shared_ptr<OutputLogicGate> mOutputPin; ///< Beam's output pin (Uses an invisible logic gate)
 
 
 public:
     Beam(Game* game, int senderOffset);
     void Draw(wxGraphicsContext* graphics) override;
+    void Record(RenderList* list) override;
+    wxRect2DDouble GetBounds() override;
     void DetectProduct(bool productDetected);
     int GetOutputPinVal() const;
     void XmlLoad(wxXmlNode* node) override;
@@ -40,13 +44,13 @@ public:
      * @brief Retrieves the width of the receiver bitmap.
      * @return The width of the receiver bitmap as an integer.
      */
-    int GetWidth() const { return mReceiverBitmap->GetWidth(); }
+    int GetWidth() const { return mReceiverGreenBitmap->GetWidth(); }
 
     /**
     * @brief Retrieves the height of the receiver bitmap.
     * @return The height of the receiver bitmap as an integer.
     */
-    int GetHeight() const { return mReceiverBitmap->GetHeight(); }
+    int GetHeight() const { return mReceiverGreenBitmap->GetHeight(); }
 
     /**
      * Accept a visitor
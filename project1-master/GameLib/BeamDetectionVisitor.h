@@ -12,10 +12,14 @@ class Beam;
 class OrLogicGate;
 class Product;
 
+#include <algorithm>
+#include <vector>
+
 #include "ItemVisitor.h"
 #include "Beam.h"
 #include "Product.h"
 #include "OrLogicGate.h"
+#include "SweptInterval.h"
 
 
 
@@ -23,12 +27,24 @@ class Product;
  * @class BeamDetectionVisitor
  * @brief Detects if products intersect with a beam in the conveyor system.
  *
- * This visitor checks for intersections between products and a specified beam.
+ * This visitor sweeps each product over the path it travelled during the
+ * tick and checks it against the beam, so fast products can't jump over it.
+ * Every product entering or leaving the beam is recorded as a crossing.
  * After visiting items, `UpdateBeamState()` updates the beam's detection status.
  */
 class BeamDetectionVisitor : public ItemVisitor
 {
 public:
+ /**
+  * A product entering or leaving the beam during the tick
+  */
+ struct Crossing
+ {
+  Product* mProduct; ///< The product that crossed the beam
+  double mTime; ///< Fraction of the tick at which it crossed
+  bool mEntered; ///< true if the product entered the beam, false if it left
+ };
+
  BeamDetectionVisitor() : mProductDetected(false), mCurrentBeam(nullptr) {}
 
  /**
@@ -42,42 +58,50 @@ public:
  }
 
  /**
- * @brief Checks if a product intersects with the current beam.
+ * @brief Checks if a product crossed the current beam during this tick.
  *
- * Calculates the product's bounding box and checks if it overlaps with the beam's range.
+ * Sweeps the product's bounding box from where it started the tick to where
+ * it is now and checks if it overlapped the beam's range at any time.
  * @param product The product to check for intersection.
  */
  void VisitProduct(Product* product) override
  {
   if (!mCurrentBeam) return;  //> Ensure a beam is set before processing
 
-  int senderX = mCurrentBeam->GetX() + mCurrentBeam->GetSenderOffset();
-  int senderY = mCurrentBeam->GetY();
-  int receiverX = mCurrentBeam->GetX();
-  int receiverY = mCurrentBeam->GetY();
-
-  /// Calculate Product's bounding box
-  int productX = product->GetX();
-  int productY = product->GetY();
-  int productHalfWidth = product->GetWidth() / 2;
-  int productHalfHeight = product->GetHeight() / 2;
+  double senderX = mCurrentBeam->GetX() + mCurrentBeam->GetSenderOffset();
+  double receiverX = mCurrentBeam->GetX();
+  double beamY = mCurrentBeam->GetY();
+
+  double productHalfWidth = product->GetWidth() / 2.0;
+  double productHalfHeight = product->GetHeight() / 2.0;
+
+  // Sweep the product's bounding box in each direction and keep the times both overlap
+  double startX = product->GetSweepStartX();
+  double startY = product->GetSweepStartY();
+  SweptInterval interval = SweptInterval::Sweep(startX - productHalfWidth, startX + productHalfWidth,
+                                                product->GetX() - productHalfWidth,
+                                                product->GetX() + productHalfWidth,
+                                                senderX, receiverX);
+  interval.Intersect(SweptInterval::Sweep(startY - productHalfHeight, startY + productHalfHeight,
+                                          product->GetY() - productHalfHeight,
+                                          product->GetY() + productHalfHeight,
+                                          beamY, beamY));
+
+  if (interval.IsEmpty())
+  {
+   return;
+  }
 
-  // Calculate the product's bounding box coordinates
-  int productLeftX = productX - productHalfWidth;
-  int productRightX = productX + productHalfWidth;
-  int productTopY = productY - productHalfHeight;
-  int productBottomY = productY + productHalfHeight;
+  mProductDetected = true;  //> Mark as detected if Product intersected the beam this tick
 
-  // Check if the Product overlaps with the beam range
-  bool withinXRange = (productRightX > senderX && productLeftX < receiverX);
-  bool withinYRange = (productBottomY > senderY && productTopY < receiverY);
+  if (interval.Entered())
+  {
+   mCrossings.push_back({product, interval.GetEnter(), true});
+  }
 
-  if (withinXRange && withinYRange)
+  if (interval.Exited())
   {
-   mProductDetected = true;  //> Mark as detected if Product intersects the beam
-   mCurrentBeam->GetGame()->SetItemHitThisCycle(true);
-   mCurrentBeam->GetGame()->SetItemPreviouslyHit(true);
-   mCurrentBeam->GetGame()->SetCurrentProduct(product);
+   mCrossings.push_back({product, interval.GetExit(), false});
   }
  }
 
@@ -92,8 +116,17 @@ public:
   {
    mCurrentBeam->DetectProduct(mProductDetected);
   }
+
+  std::stable_sort(mCrossings.begin(), mCrossings.end(),
+                   [](const Crossing& a, const Crossing& b) { return a.mTime < b.mTime; });
  }
 
+ /**
+  * Get the beam crossings found this tick, ordered by time once UpdateBeamState is called
+  * @return Vector of crossings
+  */
+ const std::vector<Crossing>& GetCrossings() const { return mCrossings; }
+
 private:
  /**
  * @brief Pointer to the beam currently being checked for product detection.
@@ -104,6 +137,11 @@ private:
   * @brief Flag indicating whether a product was detected within the beam's range.
   */
  bool mProductDetected;        // Whether a product was detected within the beam path
+
+ /**
+  * @brief Products that entered or left the beam this tick.
+  */
+ std::vector<Crossing> mCrossings;
 };
 
 
@@ -0,0 +1,82 @@
+/**
+ * @file CompiledLevel.h
+ * @author Conner O'Sullivan
+ *
+ * Layout of the binary compiled level format
+ *
+ * A compiled level is a CompiledLevelHeader followed by its item table,
+ * its product table, its sensor outputs and finally its text:
+ *
+ *     CompiledLevelHeader
+ *     CompiledItem[mItemCount]
+ *     CompiledProduct[mProductCount]
+ *     wxUint8[mOutputCount]        Product::Properties of each sensor output
+ *     char[mTextLength]            UTF-8 text, such as scoreboard goals
+ *
+ * Every value is stored in the byte order of the machine that compiled
+ * the level, and the file is read in place, so the structures only hold
+ * fixed size fields laid out without padding. Product::Properties values
+ * are stored directly, so changing that enum means bumping the version.
+ */
+
+#ifndef COMPILEDLEVEL_H
+#define COMPILEDLEVEL_H
+
+/// Identifies a compiled level file
+const char CompiledLevelMagic[4] = {'S', 'B', 'L', 'V'};
+
+/// Version of the compiled level format, bumped whenever the layout changes
+const wxUint32 CompiledLevelVersion = 1;
+
+/// Kinds of item in the item table
+enum class CompiledItemType : wxUint32
+{
+    Sensor,     ///< mFirst and mCount select its outputs
+    Conveyor,   ///< Parameters are speed, height, panel x and panel y, mFirst and mCount select its products
+    Beam,       ///< Parameter is the sender offset
+    Sparty,     ///< Parameters are height, pin x, pin y, kick duration and kick speed
+    Scoreboard  ///< Parameters are the good and bad scores, mFirst and mCount select its goal text
+};
+
+/// The start of a compiled level file
+struct CompiledLevelHeader
+{
+    char mMagic[4]; ///< Always CompiledLevelMagic
+    wxUint32 mVersion; ///< Always CompiledLevelVersion
+    wxInt32 mWidth; ///< Width of the level in virtual pixels
+    wxInt32 mHeight; ///< Height of the level in virtual pixels
+    wxUint32 mItemCount; ///< Number of items in the item table
+    wxUint32 mProductCount; ///< Number of products in the product table
+    wxUint32 mOutputCount; ///< Number of sensor outputs
+    wxUint32 mTextLength; ///< Number of bytes of text
+};
+
+/// An item in the item table
+struct CompiledItem
+{
+    wxUint32 mType; ///< A CompiledItemType
+    wxUint32 mFirst; ///< First product, output or byte of text that belongs to the item
+    wxUint32 mCount; ///< Number of products, outputs or bytes of text that belong to the item
+    wxUint32 mReserved; ///< Always zero, keeps the doubles aligned
+    double mX; ///< X location of the item
+    double mY; ///< Y location of the item
+    double mParameters[5]; ///< Values that depend on the type of item
+};
+
+/// A product in the product table
+struct CompiledProduct
+{
+    double mX; ///< Absolute X location the product starts at
+    double mY; ///< Absolute Y location the product starts at
+    wxUint8 mShape; ///< Product::Properties shape
+    wxUint8 mColor; ///< Product::Properties color
+    wxUint8 mContent; ///< Product::Properties content
+    wxUint8 mKick; ///< 1 if the product should be kicked
+    wxUint32 mReserved; ///< Always zero, keeps the size a multiple of eight
+};
+
+static_assert(sizeof(CompiledLevelHeader) == 32, "Compiled level header must not be padded");
+static_assert(sizeof(CompiledItem) == 72, "Compiled items must not be padded");
+static_assert(sizeof(CompiledProduct) == 24, "Compiled products must not be padded");
+
+#endif //COMPILEDLEVEL_H
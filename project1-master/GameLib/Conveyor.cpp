@@ -11,6 +11,13 @@
 #include "ConveyorProductMoveVisitor.h"
 #include "Game.h"
 #include "ScoreboardVisitor.h"
+#include "ImageCache.h"
+#include "GraphicsBitmapCache.h"
+#include "RenderList.h"
+#include "ProductGenerator.h"
+
+#include <cmath>
+#include <cstring>
 
 /// Image directory
 const std::wstring DirectoryContainingImages = L"resources/images/";
@@ -23,6 +30,10 @@ const std::wstring ConveyorPanelStoppedImage = DirectoryContainingImages + L"con
 /// Image for the conveyor control panel when started.
 const std::wstring ConveyorPanelStartedImage = DirectoryContainingImages + L"conveyor-switch-start.png";
 
+/// Number of copies of the belt image in the belt strip. One period above
+/// the conveyor so the strip can scroll, and two to cover the conveyor.
+const int BeltStripTiles = 3;
+
 // Rectangle representing the location of the start button relative to the panel @returns wxRect
 //const wxRect StartButtonRect(35, 29, 95, 36);
 // Rectangle representing the location of the stop button relative to the panel @returns wxRect
@@ -39,19 +50,15 @@ const std::wstring ConveyorPanelStartedImage = DirectoryContainingImages + L"con
 Conveyor::Conveyor(Game* game, int speed, double height, wxPoint panelLocation)
     : Item(game, ConveyorBackgroundImage), mPanelLocation(panelLocation), mSpeed(speed), mHeight(height)
 {
-    wxImage backgroundImage(ConveyorBackgroundImage);
-    mBackgroundBitmap = wxBitmap(backgroundImage);
-    wxImage beltImage(ConveyorBeltImage);
-    mBeltBitmap = wxBitmap(beltImage);
-    wxImage panelStartedImage(ConveyorPanelStartedImage);
-    mPanelStartedBitmap = wxBitmap(panelStartedImage);
-    wxImage panelStoppedImage(ConveyorPanelStoppedImage);
-    mPanelStoppedBitmap = wxBitmap(panelStoppedImage);
+    mBackgroundBitmap = ImageCache::GetBitmap(ConveyorBackgroundImage);
+    mBeltBitmap = ImageCache::GetBitmap(ConveyorBeltImage);
+    mPanelStartedBitmap = ImageCache::GetBitmap(ConveyorPanelStartedImage);
+    mPanelStoppedBitmap = ImageCache::GetBitmap(ConveyorPanelStoppedImage);
 }
 
 /**
- * Draws the conveyor on the given graphics context.
- * NOTE: UNSURE IF THIS IS THE INTENDED SOLUTION
+ * Draws the moving belt and the control panel on the given graphics context.
+ * The conveyor frame is static and drawn by DrawStatic.
  *
  * GetX() - newWidth / 2, GetY() - mHeight is because the X & Y provided is
  * where the XML wants the conveyor to be centered at, we have to adjust these values when
@@ -61,44 +68,37 @@ Conveyor::Conveyor(Game* game, int speed, double height, wxPoint panelLocation)
  */
 void Conveyor::Draw(wxGraphicsContext* graphics)
 {
-    // Draw the background
-    double aspectRatio = mBackgroundBitmap.GetWidth() / (1.0 * mBackgroundBitmap.GetHeight());
-    double newWidth = mHeight * aspectRatio;
-    graphics->DrawBitmap(mBackgroundBitmap, GetX() - newWidth / 2, GetY() - mHeight / 2, newWidth, mHeight);
+    RenderList list;
+    Record(&list);
+    list.Replay(graphics);
+}
 
+/**
+ * Records the commands that draw the moving belt and the control panel.
+ *
+ * @param list The render list to record into.
+ */
+void Conveyor::Record(RenderList* list)
+{
     // Calculate belt dimensions
-    double beltWidth = mBeltBitmap.GetWidth();
-    double beltHeight = mBeltBitmap.GetHeight();
+    double beltWidth = mBeltBitmap->GetWidth();
+    double beltHeight = mBeltBitmap->GetHeight();
     double scaledBeltWidth = mHeight * (beltWidth / beltHeight);
 
-    // Wrap the mBeltOffset when it exceeds the height of the belt
-    if (mBeltOffset >= beltHeight)
+    double scale = GetGame()->GetScale();
+    if (mBeltStrip == nullptr || scale != mBeltStripScale || mHeight != mBeltStripHeight)
     {
-        mBeltOffset -= beltHeight;
+        RenderBeltStrip(scale);
     }
 
-    // First draw: belt with the vertical offset
-    graphics->DrawBitmap(mBeltBitmap, GetX() - scaledBeltWidth / 2, GetY() - mBeltOffset - mHeight / 2, scaledBeltWidth, beltHeight);
-
-    // Second draw: ensure seamless wrapping by drawing the belt immediately after the first one
-    graphics->DrawBitmap(mBeltBitmap, GetX() - scaledBeltWidth / 2, GetY() - mBeltOffset + beltHeight - mHeight / 2, scaledBeltWidth, beltHeight);
-
-    // Handle the case where the first draw doesn't fill the screen
-    if (mBeltOffset > 0)
-    {
-        graphics->DrawBitmap(mBeltBitmap, GetX() - scaledBeltWidth / 2, GetY() - mBeltOffset - beltHeight - mHeight / 2, scaledBeltWidth, beltHeight);
-    }
-
-    // Special case for initial drawing: ensure the full belt is drawn
-    if (mBeltOffset == 0)
-    {
-        graphics->DrawBitmap(mBeltBitmap, GetX() - scaledBeltWidth / 2, GetY() - mHeight / 2 + beltHeight, scaledBeltWidth, beltHeight);
-    }
+    // The strip starts one belt period above the belt so any offset is covered by one blit
+    list->DrawBitmap(mBeltStrip, GetX() - scaledBeltWidth / 2, GetY() - mHeight / 2 - mBeltOffset - beltHeight,
+                     scaledBeltWidth, beltHeight * BeltStripTiles);
 
     // Draw the control panel
-    wxBitmap panelBitmap = mStarted ? mPanelStartedBitmap : mPanelStoppedBitmap;
-    graphics->DrawBitmap(panelBitmap, GetX() + mPanelLocation.x, GetY() + mPanelLocation.y,
-                         panelBitmap.GetWidth(), panelBitmap.GetHeight());
+    const auto& panelBitmap = mStarted ? mPanelStartedBitmap : mPanelStoppedBitmap;
+    list->DrawBitmap(panelBitmap, GetX() + mPanelLocation.x, GetY() + mPanelLocation.y,
+                     panelBitmap->GetWidth(), panelBitmap->GetHeight());
     // Uncomment the following code to draw button outlines for debugging
     /*
     wxPen buttonPen(*wxRED, 3);
@@ -112,6 +112,88 @@ void Conveyor::Draw(wxGraphicsContext* graphics)
     */
 }
 
+/**
+ * Make the belt strip: the belt image scaled to device pixels
+ * and repeated vertically BeltStripTiles times.
+ *
+ * Each copy is a whole number of pixels tall, so the copies
+ * join without a seam.
+ * @param scale Device pixels per virtual pixel
+ */
+void Conveyor::RenderBeltStrip(double scale)
+{
+    mBeltStripScale = scale;
+    mBeltStripHeight = mHeight;
+
+    auto belt = ImageCache::GetImage(ConveyorBeltImage);
+    double scaledBeltWidth = mHeight * (belt->GetWidth() / (1.0 * belt->GetHeight()));
+    int tileWidth = std::max(1, int(std::lround(scaledBeltWidth * scale)));
+    int tileHeight = std::max(1, int(std::lround(belt->GetHeight() * scale)));
+
+    wxImage tile = belt->Scale(tileWidth, tileHeight, wxIMAGE_QUALITY_HIGH);
+    if (!tile.HasAlpha())
+    {
+        tile.InitAlpha();
+    }
+
+    wxImage strip(tileWidth, tileHeight * BeltStripTiles, false);
+    strip.InitAlpha();
+
+    size_t tilePixels = (size_t)tileWidth * tileHeight;
+    for (int i = 0; i < BeltStripTiles; i++)
+    {
+        memcpy(strip.GetData() + tilePixels * 3 * i, tile.GetData(), tilePixels * 3);
+        memcpy(strip.GetAlpha() + tilePixels * i, tile.GetAlpha(), tilePixels);
+    }
+
+    mBeltStrip = std::make_shared<wxBitmap>(strip);
+}
+
+/**
+ * Draws the conveyor frame (background) into the static layer.
+ *
+ * @param graphics The graphics context to draw on.
+ */
+void Conveyor::DrawStatic(wxGraphicsContext* graphics)
+{
+    double aspectRatio = mBackgroundBitmap->GetWidth() / (1.0 * mBackgroundBitmap->GetHeight());
+    double newWidth = mHeight * aspectRatio;
+    graphics->DrawBitmap(GraphicsBitmapCache::Get(graphics, mBackgroundBitmap), GetX() - newWidth / 2, GetY() - mHeight / 2, newWidth, mHeight);
+}
+
+/**
+ * Get the area the conveyor draws over: the frame, the belt
+ * and the control panel.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Conveyor::GetBounds()
+{
+    double aspectRatio = mBackgroundBitmap->GetWidth() / (1.0 * mBackgroundBitmap->GetHeight());
+    double newWidth = mHeight * aspectRatio;
+    wxRect2DDouble bounds(GetX() - newWidth / 2, GetY() - mHeight / 2, newWidth, mHeight);
+
+    bounds.Union(GetBeltBounds());
+
+    const auto& panelBitmap = mStarted ? mPanelStartedBitmap : mPanelStoppedBitmap;
+    bounds.Union(wxRect2DDouble(GetX() + mPanelLocation.x, GetY() + mPanelLocation.y,
+                                panelBitmap->GetWidth(), panelBitmap->GetHeight()));
+    return bounds;
+}
+
+/**
+ * Get the area the moving belt draws over, covering
+ * every copy of the belt image for any belt offset.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Conveyor::GetBeltBounds()
+{
+    double beltHeight = mBeltBitmap->GetHeight();
+    double scaledBeltWidth = mHeight * (mBeltBitmap->GetWidth() / beltHeight);
+
+    return wxRect2DDouble(GetX() - scaledBeltWidth / 2, GetY() - mHeight / 2 - beltHeight * 2,
+                          scaledBeltWidth, beltHeight * 4);
+}
+
 /**
 * Update the conveyor belt for animation
 * @param elapsed
@@ -127,8 +209,18 @@ void Conveyor::Update(double elapsed)
         // Move all the products on the conveyor
         MoveProducts(elapsed);
 
-        // Wrap around if the offset exceeds the belt height for vertical wrapping
-        double beltHeight = mBeltBitmap.GetHeight();
+        // Products that ran off the end come back as new ones
+        if (mGenerator != nullptr)
+        {
+            mGenerator->Update();
+        }
+
+        // The belt is drawn somewhere new every update
+        GetGame()->Invalidate(GetBeltBounds());
+
+        // Keep the offset within one belt period so the belt strip always covers the conveyor
+        double beltHeight = mBeltBitmap->GetHeight();
+        mBeltOffset = std::fmod(mBeltOffset, beltHeight);
         if (mBeltOffset < 0)
         {
             mBeltOffset += beltHeight;
@@ -173,6 +265,7 @@ void Conveyor::MoveProducts(double elapsed)
 void Conveyor::Start()
 {
     mStarted = true;
+    Invalidate();
 
     // Reset the level score when start button is pressed
     ScoreboardVisitor scoreVisitor;
@@ -191,6 +284,19 @@ void Conveyor::Stop()
 {
     mStarted = false;
     mReset = true;
+    Invalidate();
+}
+
+/**
+ * Start the conveyor's generated products over, as when it is restarted
+ * after being stopped. Does nothing if the conveyor has no generator.
+ */
+void Conveyor::ResetProducts()
+{
+    if (mGenerator != nullptr)
+    {
+        mGenerator->Reset();
+    }
 }
 
 /**
@@ -11,6 +11,8 @@
 #include "Item.h"
 #include "Game.h"
 
+class ProductGenerator;
+
 /// @return Rectangle of start button
 const wxRect StartButtonRect(35, 29, 95, 36); // Check the dimensions and placement
 
@@ -24,20 +26,30 @@ class Conveyor : public Item
 
 {
 private:
-    wxBitmap mBackgroundBitmap; ///< Bitmap for coneyorbelt background
-    wxBitmap mBeltBitmap; ///< Bitmap for the belt
-    wxBitmap mPanelStartedBitmap; ///< Bitmap for the panel when started is on
-    wxBitmap mPanelStoppedBitmap; ///< Bitmap for the panel when stopped is on
+    std::shared_ptr<wxBitmap> mBackgroundBitmap; ///< Bitmap for coneyorbelt background
+    std::shared_ptr<wxBitmap> mBeltBitmap; ///< Bitmap for the belt
+    std::shared_ptr<wxBitmap> mPanelStartedBitmap; ///< Bitmap for the panel when started is on
+    std::shared_ptr<wxBitmap> mPanelStoppedBitmap; ///< Bitmap for the panel when stopped is on
     wxPoint mPanelLocation; ///< Location for the stop/start panel
     bool mStarted = false; ///< Keeps track of state of conveyorbelt
     double mHeight; ///< Height of conveyor belt
     int mSpeed; ///< Speed at which conveyorbelt moves
     double mBeltOffset = 0; ///< Keeps track of how far the belt has moved
     bool mReset = false; ///< sets the current state of resetting the conveyor to false
+    std::shared_ptr<wxBitmap> mBeltStrip; ///< Belt tiled vertically and scaled to device pixels
+    double mBeltStripScale = 0; ///< Scale the belt strip was made for
+    double mBeltStripHeight = 0; ///< Conveyor height the belt strip was made for
+    std::shared_ptr<ProductGenerator> mGenerator; ///< Makes the products for an endless conveyor, if any
+
+    wxRect2DDouble GetBeltBounds();
+    void RenderBeltStrip(double scale);
 
 public:
     Conveyor(Game* game, int speed, double height, wxPoint panelLocation);
     void Draw(wxGraphicsContext* graphics) override;
+    void Record(RenderList* list) override;
+    void DrawStatic(wxGraphicsContext* graphics) override;
+    wxRect2DDouble GetBounds() override;
     void Start();
     void Stop();
     void XmlLoad(wxXmlNode* node) override;
@@ -45,6 +57,20 @@ public:
     void MoveProducts(double elapsed);
     void Update(double elapsed) override;
 
+    /**
+     * Get the height of the conveyor
+     * @return Height in virtual pixels
+     */
+    double GetHeight() const { return mHeight; }
+
+    /**
+     * Set the generator that makes the conveyor's products as it runs
+     * @param generator The generator
+     */
+    void SetGenerator(std::shared_ptr<ProductGenerator> generator) { mGenerator = generator; }
+
+    void ResetProducts();
+
     /// Expose the panel location so visitors can access it @return location of the panel
     wxPoint GetPanelLocation() const { return mPanelLocation; }
 
@@ -6,6 +6,8 @@
 
 #include "pch.h"
 #include "DLogicGate.h"
+#include "Game.h"
+#include "RenderList.h"
 
 /**
  * @brief Size of the D Flip Flop gate in pixels.
@@ -19,6 +21,15 @@ const int DGateLabelMargin = 3;
 /// Font size for labels
 const int DGateFontSize = 15;
 
+/// Label of the D input
+const wxString DLabelD = L"D";
+
+/// Label of the Q output
+const wxString DLabelQ = L"Q";
+
+/// Label of the Q' output
+const wxString DLabelQBar = L"Q'";
+
 
 /**
  * @brief Constructor for the D Flip Flop Logic Gate.
@@ -40,12 +51,12 @@ DLogicGate::DLogicGate(Game* game) : LogicGate(game)
     const wxPoint OutputPinLocation1((x + w / 1.2), (y + h / 4.0));
     const wxPoint OutputPinLocation2((x + w / 1.2), (y - h / 4.0));
 
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation1)); // Clock
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation2)); // D
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation1)); // Q
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation2)); // Q'
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation1)); // Clock
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation2)); // D
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation1)); // Q
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation2)); // Q'
 
-    auto outputGates = GetOutputPins();
+    auto& outputGates = GetOutputPins();
     outputGates[0]->SetState(State::One);
     outputGates[1]->SetState(State::Zero);
 
@@ -53,12 +64,13 @@ DLogicGate::DLogicGate(Game* game) : LogicGate(game)
 
 
 /**
- * @brief Draws the D Flip Flop logic gate.
+ * @brief Records the D Flip Flop logic gate.
  *
- * This function creates and draws the shape of the D Flip Flop gate on the given
- * gc context using Bezier curves.
+ * This function records the box of the D Flip Flop gate with its
+ * clock triangle and labels.
+ * @param list The render list to record into
  */
-void DLogicGate::Draw(wxGraphicsContext* gc)
+void DLogicGate::Record(RenderList* list)
 {
     // Get position and size
     auto x = GetX();
@@ -66,33 +78,11 @@ void DLogicGate::Draw(wxGraphicsContext* gc)
     auto w = GetWidth();
     auto h = GetHeight();
 
-    DrawPins(gc);
-
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxBLACK_BRUSH);
-
-    // Bottom input
-    //gc->StrokeLine((x - w / 3), (y + h / 4.0), (x - w / 1.2), (y + h / 4));
-    //gc->DrawEllipse(((-h / 20) + x - w / 1.2), ((-h / 20) + y + h / 4.0), h / 10, h / 10);
-
-    // Top input
-    //gc->StrokeLine((x - w / 3), (y - h / 4.0), (x - w / 1.2), (y - h / 4));
-    //gc->DrawEllipse(((-h / 20) + x - w / 1.2), ((-h / 20) + y - h / 4.0), h / 10, h / 10);
-
-    // Bottom output
-    //gc->StrokeLine((x + w / 3), (y + h / 4.0), (x + w / 1.2), (y + h / 4));
-    //gc->DrawEllipse(((-h / 20) + x + w / 1.2), ((-h / 20) + y + h / 4.0), h / 10, h / 10);
-
-    // Top output
-    //gc->StrokeLine((x + w / 3), (y - h / 4.0), (x + w / 1.2), (y - h / 4));
-    //gc->DrawEllipse(((-h / 20) + x + w / 1.2), ((-h / 20) + y - h / 4.0), h / 10, h / 10);
-
+    RecordPins(list);
 
     // Draw the flip-flop rectangle
     wxRect2DDouble rect(x - w / 2, y - h / 2, w, h);
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxWHITE_BRUSH);
-    gc->DrawRectangle(rect.m_x, rect.m_y, rect.m_width, rect.m_height);
+    list->DrawRectangle(rect.m_x, rect.m_y, rect.m_width, rect.m_height, *wxBLACK, *wxWHITE);
 
     // Cut the height into fourths
     double fourth = h / 4;
@@ -102,49 +92,46 @@ void DLogicGate::Draw(wxGraphicsContext* gc)
     wxPoint2DDouble p2(p1.m_x + DGateFontSize, y + fourth);
     wxPoint2DDouble p3(p1.m_x, y + fourth + DGateFontSize / 2);
 
-    auto path = gc->CreatePath();
-    path.MoveToPoint(p1);
-    path.AddLineToPoint(p2);
-    path.AddLineToPoint(p3);
-    path.CloseSubpath();
-    gc->DrawPath(path);
-
-    // Draw fonts
-    auto font = gc->CreateFont(DGateFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
-    gc->SetFont(font);
+    list->MoveTo(p1);
+    list->LineTo(p2);
+    list->LineTo(p3);
+    list->ClosePath();
+    list->FillPath(*wxBLACK, *wxWHITE);
 
-    wxString text = "Q";
-    wxDouble textWidth, textHeight;
-    gc->GetTextExtent(text, &textWidth, &textHeight);
+    // The labels are only measured the first time any D flip flop is drawn
+    double textWidth, textHeight;
+    list->GetTextExtent(DLabelQ, DGateFontSize, L"Arial", wxFONTFLAG_BOLD, &textWidth, &textHeight);
 
-    wxDouble halfTextHeight = textHeight / 2;
+    double halfTextHeight = textHeight / 2;
 
-    wxString text2 = "Q'";
-    gc->GetTextExtent(text2, &textWidth, &textHeight);
-    wxDouble halfText2Height = textHeight / 2;
+    list->GetTextExtent(DLabelQBar, DGateFontSize, L"Arial", wxFONTFLAG_BOLD, &textWidth, &textHeight);
+    double halfText2Height = textHeight / 2;
 
     // Draw D at top
-    gc->DrawText(L"D", rect.m_x + DGateLabelMargin, y - fourth - halfTextHeight);
+    list->DrawText(DLabelD, rect.m_x + DGateLabelMargin, y - fourth - halfTextHeight,
+                   DGateFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
 
     // Draw Q at top
-    gc->DrawText(text, rect.m_x + w - textWidth - DGateLabelMargin, y - fourth - halfTextHeight);
+    list->DrawText(DLabelQ, rect.m_x + w - textWidth - DGateLabelMargin, y - fourth - halfTextHeight,
+                   DGateFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
 
     // Draw Q' at the bottom
-    gc->DrawText(text2, rect.m_x + w - textWidth - DGateLabelMargin, y + fourth - halfText2Height);
+    list->DrawText(DLabelQBar, rect.m_x + w - textWidth - DGateLabelMargin, y + fourth - halfText2Height,
+                   DGateFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
 }
 
 void DLogicGate::ComputeOutput()
 {
-    auto inputPins = GetPinInputs();
-    auto outputPins = GetOutputPins();
+    auto& inputPins = GetPinInputs();
+    auto& outputPins = GetOutputPins();
     
     // Get D and Clock inputs
-    auto dInput = inputPins[1];    // D
-    auto clockInput = inputPins[0]; // Clock
+    auto& dInput = inputPins[1];    // D
+    auto& clockInput = inputPins[0]; // Clock
     
     // Get Q and Q' outputs
-    auto qOutput = outputPins[1];    // Q
-    auto qBarOutput = outputPins[0];  // Q'
+    auto& qOutput = outputPins[1];    // Q
+    auto& qBarOutput = outputPins[0];  // Q'
 
      // On clock rising edge (transition from 0 to 1)
     if (mPreviousClockState == State::Zero && clockInput->GetState() == State::One)
@@ -45,11 +45,11 @@ public:
     void operator=(const DLogicGate&) = delete;
 
     /**
-     * @brief Draw the D Flip Flop Logic Gate.
+     * @brief Record the D Flip Flop Logic Gate.
      *
-     * @param gc Pointer to the wxGraphicsContext used for drawing.
+     * @param list The render list to record into.
      */
-    void Draw(wxGraphicsContext* gc) override;
+    void Record(RenderList* list) override;
 
     /**
     * Accept a visitor
@@ -14,6 +14,10 @@
 #include "Banner.h"
 #include "LogicGate.h"
 #include "LevelLoader.h"
+#include "CompiledLevel.h"
+#include "MappedFile.h"
+#include "GraphicsBitmapCache.h"
+#include "GraphicsResourceCache.h"
 
 // Visitors
 #include "UpdateVisitor.h"
@@ -22,9 +26,15 @@
 #include "ProductResetVisitor.h"
 #include "SensorDetectionVisitor.h"
 #include "SpartyProductVisitor.h"
+#include "ProductSweepVisitor.h"
+#include "PropagationVisitor.h"
+#include "OutputPinVisitor.h"
 
 #include <wx/xml/xml.h>
 #include <memory>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
 
 #include "StopConveyorVisitor.h"
 
@@ -65,6 +75,10 @@ const double LevelNoticeWidth = 820;
 /// constant that makes banner look centered.
 const double eighteenth = 0.18;
 
+/// Margin added around changed areas in virtual pixels so wide
+/// pens and antialiased edges are repainted too
+const double DirtyMargin = 5;
+
 
 /**
  * Game Constructor
@@ -132,11 +146,15 @@ Game::Game()
 
 /**
  * Draw the Game
+ *
+ * When an update region is given only the items that overlap
+ * it are drawn and drawing is clipped to it.
  * @param graphics The graphics context to draw on
  * @param width The width of the window
  * @param height The height of the window
+ * @param updateRegion Part of the window to repaint in window pixels, empty to repaint it all
  */
-void Game::OnDraw(std::shared_ptr<wxGraphicsContext>& graphics, int width, int height)
+void Game::OnDraw(std::shared_ptr<wxGraphicsContext>& graphics, int width, int height, const wxRegion& updateRegion)
 {
     // Determine the size of the playing area in pixels
     // This is up to you...
@@ -157,6 +175,19 @@ void Game::OnDraw(std::shared_ptr<wxGraphicsContext>& graphics, int width, int h
         mYOffset = (double)((height - pixelHeight * mScale) / 2.0);
     }
 
+    // Composite the parts of the scene that don't change, rendering them if the size changed
+    if (mStaticLayer == nullptr || mStaticLayer->GetWidth() != width || mStaticLayer->GetHeight() != height)
+    {
+        RenderStaticLayer(width, height);
+    }
+
+    if (!updateRegion.IsEmpty())
+    {
+        graphics->Clip(updateRegion);
+    }
+
+    graphics->DrawBitmap(GraphicsBitmapCache::Get(graphics.get(), mStaticLayer), 0, 0, width, height);
+
     graphics->PushState();
 
     graphics->Translate(mXOffset, mYOffset);
@@ -169,17 +200,42 @@ void Game::OnDraw(std::shared_ptr<wxGraphicsContext>& graphics, int width, int h
     // Draw in virtual pixels on the graphics context
     //
 
-    // Set the background color to green
-    wxBrush background(wxColour(230, 255, 230, 255));
-    graphics->SetBrush(background);
-    graphics->DrawRectangle(0, 0, pixelWidth, pixelHeight);
-
     // Drawing code goes here
+    wxRect2DDouble visible(0, 0, pixelWidth, pixelHeight);
+    wxRect2DDouble area = visible;
+    if (!updateRegion.IsEmpty())
+    {
+        auto box = updateRegion.GetBox();
+        wxRect2DDouble::Intersect(visible,
+                                  wxRect2DDouble(GetVirtualPixelsX(box.GetLeft()), GetVirtualPixelsY(box.GetTop()),
+                                                 box.GetWidth() / mScale, box.GetHeight() / mScale),
+                                  &area);
+    }
+
+    mRenderList.Clear();
     for (auto& item : mItems)
     {
-        item->Draw(graphics.get());
+        auto bounds = item->GetBounds();
+
+        // Items entirely outside the level, like products still waiting above the conveyor, can't be seen
+        if (!bounds.Intersects(visible))
+        {
+            continue;
+        }
+
+        // Items clear of the area being repainted are still on screen as they were
+        if (!updateRegion.IsEmpty() && updateRegion.Contains(ToWindowRect(bounds)) == wxOutRegion)
+        {
+            continue;
+        }
+
+        item->Record(&mRenderList);
     }
 
+    RecordWires(area);
+
+    mRenderList.Replay(graphics.get());
+
     // Draw the end banner
     if (mHasLevelEnded)
     {
@@ -189,14 +245,168 @@ void Game::OnDraw(std::shared_ptr<wxGraphicsContext>& graphics, int width, int h
     graphics->PopState();
 }
 
+/**
+ * Record the wires between the gates that cross an area.
+ *
+ * The wires are drawn over every item, and every wire in a
+ * state is one path, so each colour is stroked only once.
+ * @param area Area being drawn in virtual pixels
+ */
+void Game::RecordWires(const wxRect2DDouble& area)
+{
+    mWirePins.clear();
+    OutputPinVisitor visitor(&mWirePins);
+    for (auto& item : mItems)
+    {
+        item->Accept(&visitor);
+    }
+
+    for (auto state : {State::One, State::Zero, State::Unknown})
+    {
+        size_t count = 0;
+        for (auto pin : mWirePins)
+        {
+            if (pin->GetState() == state)
+            {
+                count += pin->RecordWires(&mRenderList, area);
+            }
+        }
+
+        if (count > 0)
+        {
+            mRenderList.StrokePath(PinOutput::GetConnectionColor(state), PinOutput::LineWidth);
+        }
+    }
+
+    // The control points go over the wires
+    for (auto pin : mWirePins)
+    {
+        pin->RecordWireControlPoints(&mRenderList, area);
+    }
+}
+
+/**
+ * Draw the whole game into an image without a window, the
+ * same way the view draws it into a window of this size.
+ * @param width Width of the image in pixels
+ * @param height Height of the image in pixels
+ * @return The drawn image
+ */
+wxImage Game::RenderImage(int width, int height)
+{
+    wxBitmap bitmap(std::max(width, 1), std::max(height, 1));
+
+    {
+        wxMemoryDC dc(bitmap);
+        dc.SetBackground(*wxBLACK_BRUSH);
+        dc.Clear();
+
+        // The context has to be gone before the bitmap is released from the dc
+        auto graphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(dc));
+        OnDraw(graphics, width, height);
+    }
+
+    return bitmap.ConvertToImage();
+}
+
+/**
+ * Render the parts of the scene that never change during a level into
+ * an offscreen bitmap at the current scale: the background and
+ * whatever each item draws in DrawStatic.
+ * @param width The width of the window
+ * @param height The height of the window
+ */
+void Game::RenderStaticLayer(int width, int height)
+{
+    mStaticLayer = make_shared<wxBitmap>(std::max(width, 1), std::max(height, 1));
+
+    wxMemoryDC dc(*mStaticLayer);
+    dc.SetBackground(*wxBLACK_BRUSH);
+    dc.Clear();
+
+    auto graphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(dc));
+
+    graphics->Translate(mXOffset, mYOffset);
+    graphics->Scale(mScale, mScale);
+    graphics->Clip(0, 0, mLevelWidth, mLevelHeight);
+
+    // Set the background color to green
+    wxBrush background(wxColour(230, 255, 230, 255));
+    graphics->SetBrush(background);
+    graphics->DrawRectangle(0, 0, mLevelWidth, mLevelHeight);
+
+    for (auto& item : mItems)
+    {
+        item->DrawStatic(graphics.get());
+    }
+}
+
+/**
+ * Mark an area of the level as needing to be repainted
+ * @param rect Changed area in virtual pixels
+ */
+void Game::Invalidate(const wxRect2DDouble& rect)
+{
+    if (!mAllDirty)
+    {
+        mDirtyRects.push_back(rect);
+    }
+}
+
+/**
+ * Take the areas of the window that have to be repainted
+ * since the last time this was called.
+ * @param rects Vector the changed areas are added to in window pixels
+ * @return true if the whole window has to be repainted instead
+ */
+bool Game::TakeDirtyRects(std::vector<wxRect>& rects)
+{
+    bool all = mAllDirty;
+    if (!all)
+    {
+        for (auto& rect : mDirtyRects)
+        {
+            rects.push_back(ToWindowRect(rect));
+        }
+    }
+
+    mDirtyRects.clear();
+    mAllDirty = false;
+    return all;
+}
+
+/**
+ * Convert an area in virtual pixels to the window pixels
+ * that cover it at the current scale.
+ * @param rect Area in virtual pixels
+ * @return Area in window pixels
+ */
+wxRect Game::ToWindowRect(const wxRect2DDouble& rect)
+{
+    int left = int(std::floor((rect.m_x - DirtyMargin) * mScale + mXOffset));
+    int top = int(std::floor((rect.m_y - DirtyMargin) * mScale + mYOffset));
+    int right = int(std::ceil((rect.m_x + rect.m_width + DirtyMargin) * mScale + mXOffset));
+    int bottom = int(std::ceil((rect.m_y + rect.m_height + DirtyMargin) * mScale + mYOffset));
+    return wxRect(left, top, right - left, bottom - top);
+}
+
 /**
  * Add an item to the Game
  * @param item New item to add
  */
 void Game::Add(std::shared_ptr<Item> item)
 {
+    if (mBuildingNextLevel)
+    {
+        // The next level isn't shown yet, so nothing has to be repainted
+        mNextItems.push_back(item);
+        item->SetShowControlOutputPins(mShowControlPoints);
+        return;
+    }
+
     mItems.push_back(item);
     item->SetShowControlOutputPins(mShowControlPoints); //Sets new gates with the correct state
+    InvalidateStaticLayer();
 }
 
 /**
@@ -220,6 +430,9 @@ void Game::BringItemToFront(Item* item)
     }
 
     mItems.push_back(itemPtr);
+
+    // It is now drawn over whatever it overlaps
+    item->Invalidate();
 }
 
 /**
@@ -268,15 +481,45 @@ std::shared_ptr<Item> Game::HitTestDefault(int x, int y)
     return nullptr;
 }
 
+/**
+ * Read the size of a level from its parsed file
+ * @param xmlDoc The parsed level file
+ * @param width Receives the width of the level, unchanged if the size can't be read
+ * @param height Receives the height of the level, unchanged if the size can't be read
+ */
+static void ReadLevelSize(const wxXmlDocument& xmlDoc, int* width, int* height)
+{
+    // Get the XML document root node
+    auto root = xmlDoc.GetRoot();
+
+    // Parse level size
+    wxString sizeStr = root->GetAttribute(L"size", L"1150,800");
+    wxArrayString sizeParts = wxSplit(sizeStr, L',');
+    if (sizeParts.size() == 2)
+    {
+        // Convert the pin values to doubles
+        sizeParts[0].ToInt(width);
+        sizeParts[1].ToInt(height);
+    }
+}
+
 /**
  * Load the Level from an XML file.
  *
  * Opens the XML file and reads the nodes, creating items as appropriate.
+ * Files ending in .lvl are compiled levels, which are mapped into memory
+ * and read in place instead.
  *
  * @param filename The filename of the file to load the level from.
  */
 void Game::LoadLevel(const wxString& filename)
 {
+    if (filename.EndsWith(L".lvl"))
+    {
+        LoadCompiledLevel(filename);
+        return;
+    }
+
     wxXmlDocument xmlDoc;
     if (!xmlDoc.Load(filename))
     {
@@ -286,29 +529,53 @@ void Game::LoadLevel(const wxString& filename)
 
     ClearLevel();
 
-    // Get the XML document root node
-    auto root = xmlDoc.GetRoot();
+    ReadLevelSize(xmlDoc, &mLevelWidth, &mLevelHeight);
 
-    // Parse level size
-    wxString sizeStr = root->GetAttribute(L"size", L"1150,800");
-    wxArrayString sizeParts = wxSplit(sizeStr, L',');
-    if (sizeParts.size() == 2)
+    // The loader works from the document we already parsed instead of reading the file again
+    LevelLoader loader(this);
+    loader.Load(xmlDoc);
+
+    AddLevelBanner(filename);
+}
+
+/**
+ * Load the Level from a compiled level file.
+ * @param filename The filename of the compiled level, made by LevelCompiler
+ */
+void Game::LoadCompiledLevel(const wxString& filename)
+{
+    MappedFile file(filename);
+    if (!LevelLoader::IsCompiledLevel(file))
     {
-        // Convert the pin values to doubles
-        sizeParts[0].ToInt(&mLevelWidth);
-        sizeParts[1].ToInt(&mLevelHeight);
+        wxMessageBox(L"Unable to load level file");
+        return;
     }
 
+    ClearLevel();
+
+    auto header = reinterpret_cast<const CompiledLevelHeader*>(file.GetData());
+    mLevelWidth = header->mWidth;
+    mLevelHeight = header->mHeight;
+
     LevelLoader loader(this);
-    loader.Load(filename);
+    loader.Load(file);
 
+    AddLevelBanner(filename);
+}
+
+/**
+ * Add the banner that announces the start of a level
+ * @param filename The filename the level was loaded from, such as level3.xml
+ */
+void Game::AddLevelBanner(const wxString& filename)
+{
     // Extract level number from filename --> This is for displaying the banner
     const wxString levelStr = filename.BeforeLast('.').AfterLast('l'); //
     long levelNum = 0;
     levelStr.ToLong(&levelNum);
     // Create and display banner
     std::wstring text = L"Level " + std::to_wstring(levelNum) + L" Begin";
-    auto banner = make_shared<Banner>(this, text);
+    auto banner = GetLevelArena()->Make<Banner>(this, text);
     Add(banner);
 }
 
@@ -319,7 +586,38 @@ void Game::LoadLevel(const wxString& filename)
  */
 void Game::ClearLevel()
 {
+    mRemovedItems.clear();
+    mRemovedWires.clear();
     mItems.clear();
+    mArena = RecycleArena(mArena);
+    InvalidateStaticLayer();
+}
+
+/**
+ * Get an arena ready for a new level once the objects of its old level are cleared.
+ *
+ * If nothing made from the arena is still alive it is released in one go
+ * and reused. Otherwise something outside the game still holds an object
+ * from it, so it is kept aside until that is freed and a new arena is used.
+ * @param arena The arena of the cleared level
+ * @return The arena to make the new level in
+ */
+std::shared_ptr<LevelArena> Game::RecycleArena(const std::shared_ptr<LevelArena>& arena)
+{
+    mRetiredArenas.erase(std::remove_if(mRetiredArenas.begin(), mRetiredArenas.end(),
+                                        [](const std::shared_ptr<LevelArena>& retired)
+                                        {
+                                            return retired->GetLive() == 0;
+                                        }), mRetiredArenas.end());
+
+    if (arena->GetLive() == 0)
+    {
+        arena->Release();
+        return arena;
+    }
+
+    mRetiredArenas.push_back(arena);
+    return make_shared<LevelArena>();
 }
 
 //**
@@ -354,8 +652,8 @@ void Game::DrawEndBanner(wxGraphicsContext* gc)
     if (mVisible)
     {
         // Set the brush and pen for the background rectangle
-        gc->SetBrush(wxBrush(LevelNoticeBackgrounds, wxBRUSHSTYLE_SOLID));
-        gc->SetPen(wxPen(LevelNoticeBackgrounds, 0, wxPENSTYLE_TRANSPARENT));
+        gc->SetBrush(GraphicsResourceCache::GetBrush(gc, LevelNoticeBackgrounds));
+        gc->SetPen(GraphicsResourceCache::GetPen(gc, LevelNoticeBackgrounds, 0, wxPENSTYLE_TRANSPARENT));
 
         // Figure out location to draw text
         int centerX = mLevelWidth * eighteenth;
@@ -367,8 +665,7 @@ void Game::DrawEndBanner(wxGraphicsContext* gc)
                                 NoticeSize + LevelNoticePadding + 10);
 
         // Set font and font size for text
-        auto font = gc->CreateFont(NoticeSize, L"Arial", wxFONTFLAG_BOLD, LevelNoticeColor);
-        gc->SetFont(font);
+        gc->SetFont(GraphicsResourceCache::GetFont(gc, NoticeSize, L"Arial", wxFONTFLAG_BOLD, LevelNoticeColor));
         gc->DrawText("Level Complete!", centerX, centerY);
     }
 }
@@ -407,16 +704,96 @@ void Game::Accept(ItemVisitor* visitor)
 
 
 /**
- * Remove an item from the game
+ * Remove an item from the game, along with every wire to and from it.
+ *
+ * The item is removed at the end of the current tick, so it is safe
+ * to call while the items are being updated or visited.
  * @param item The item to remove
  */
 void Game::RemoveItem(Item* item)
 {
-    //auto loc = find(std::begin(mItems), std::end(mItems), item);
-    //if (loc != std::end(mItems))
-    //{
-    //    mItems.erase(loc);
-    //}
+    if (std::find(mRemovedItems.begin(), mRemovedItems.end(), item) == mRemovedItems.end())
+    {
+        mRemovedItems.push_back(item);
+    }
+}
+
+/**
+ * Remove every wire leaving an output pin at the end of the current tick
+ * @param pinOutput The output pin
+ */
+void Game::RemoveWires(PinOutput* pinOutput)
+{
+    mRemovedWires.push_back(pinOutput->GetHandle());
+}
+
+/**
+ * Remove whatever is at a location: the wires leaving an output pin
+ * if the location is on one, otherwise the item there.
+ * @param x X location in virtual pixels
+ * @param y Y location in virtual pixels
+ * @return true if anything is to be removed
+ */
+bool Game::RemoveAt(double x, double y)
+{
+    for (auto i = mItems.rbegin(); i != mItems.rend(); i++)
+    {
+        auto pinOutput = std::dynamic_pointer_cast<PinOutput>((*i)->HitDraggable(x, y));
+        if (pinOutput != nullptr)
+        {
+            RemoveWires(pinOutput.get());
+            return true;
+        }
+
+        if ((*i)->HitTest(x, y))
+        {
+            RemoveItem(i->get());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Carry out the removals asked for during this tick.
+ *
+ * The wires are cut first, then the removed items are dropped from
+ * mItems in a single pass that keeps the rest in their drawing order.
+ */
+void Game::CompactItems()
+{
+    if (mRemovedItems.empty() && mRemovedWires.empty())
+    {
+        return;
+    }
+
+    // A handle no longer finds its pin if the pin's gate has gone since
+    for (auto handle : mRemovedWires)
+    {
+        auto pinOutput = mPinTable.Get<PinOutput>(handle);
+        if (pinOutput != nullptr)
+        {
+            pinOutput->Disconnect();
+        }
+    }
+    mRemovedWires.clear();
+
+    for (auto item : mRemovedItems)
+    {
+        item->Disconnect();
+    }
+
+    std::sort(mRemovedItems.begin(), mRemovedItems.end());
+    mItems.erase(std::remove_if(mItems.begin(), mItems.end(), [this](const std::shared_ptr<Item>& item)
+    {
+        return std::binary_search(mRemovedItems.begin(), mRemovedItems.end(), item.get());
+    }), mItems.end());
+    mRemovedItems.clear();
+
+    // Wires from other items went too, so the whole view is repainted
+    InvalidateStaticLayer();
+    InvalidateAll();
 }
 
 /**
@@ -425,6 +802,10 @@ void Game::RemoveItem(Item* item)
  */
 void Game::Update(double elapsed)
 {
+    // Mark where every product starts so detection can sweep its travel this tick
+    ProductSweepVisitor sweepVisitor;
+    Accept(&sweepVisitor);
+
     for (auto item : mItems)
     {
         item->Update(elapsed);
@@ -438,16 +819,19 @@ void Game::Update(double elapsed)
     {
         item->Accept(&beamVisitor); // Each item accepts the visitor
     }
-    if ((!mWasItemHitThisCycle) && (mWasItemPreviouslyHit))
-    {
-        mCurrentProduct->HasLeftBeam();
-        mWasItemPreviouslyHit = false;
-    }
-    mWasItemHitThisCycle = false;
 
     // Update the state of the beam after all visits
     beamVisitor.UpdateBeamState();
 
+    // Score every product that left the beam this tick, in the order they left it
+    for (auto& crossing : beamVisitor.GetCrossings())
+    {
+        if (!crossing.mEntered)
+        {
+            crossing.mProduct->HasLeftBeam();
+        }
+    }
+
     // Create the BeamDetectionVisitor
     SensorDetectionVisitor sensorVisitor;
 
@@ -460,6 +844,19 @@ void Game::Update(double elapsed)
     // Update the state of the beam after all visits
     sensorVisitor.UpdateSensorState();
 
+    // Carry the beam and sensor outputs through the gates until they settle. A circuit
+    // without loops settles within a pass per gate, one that oscillates is cut off there.
+    PropagationVisitor propagationVisitor;
+    for (size_t pass = 0; ; pass++)
+    {
+        propagationVisitor.Reset();
+        Accept(&propagationVisitor);
+        if (!propagationVisitor.HasChanged() || pass >= propagationVisitor.GetNumGates())
+        {
+            break;
+        }
+    }
+
     SpartyProductVisitor spartyProdVisit;
     for (auto& item : mItems)
     {
@@ -472,8 +869,17 @@ void Game::Update(double elapsed)
         item->Accept(&productResetVisitor);
     }
 
+    CompactItems();
+
     if (mHasLevelEnded)
     {
+        // Build the next level as soon as its file has been parsed
+        if (mNextLevelDocument.valid() &&
+            mNextLevelDocument.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            BuildNextLevel();
+        }
+
         if (mLevelLoadDelay > 0)
         {
             mLevelLoadDelay -= elapsed;
@@ -495,6 +901,7 @@ void Game::LevelComplete()
     // Stop everything from moving
     // display level complete banner
     mVisible = true;
+    InvalidateAll();
 
 
     // Get the current level score from scoreboard
@@ -514,21 +921,121 @@ void Game::LevelComplete()
     // wait a certain amount of time
     // indicates to update to set timer
     mHasLevelEnded = true;
+
+    StartNextLevel();
+}
+
+/**
+ * Get the number of the level that follows the current one
+ * @return The next level number, the last level repeats
+ */
+int Game::GetNextLevelNum() const
+{
+    return mCurrLevelNum < LastLevelNum ? mCurrLevelNum + 1 : LastLevelNum;
 }
 
+/**
+ * Start loading the next level while the level complete banner shows.
+ *
+ * The file is parsed on a worker thread. Items hold their game and
+ * bitmaps, which belong to the UI thread, so Update builds them with
+ * BuildNextLevel once the parse is done.
+ */
+void Game::StartNextLevel()
+{
+    DiscardNextLevel();
+
+    mNextLevelNum = GetNextLevelNum();
+    mNextLevelFilename = L"resources/levels/level" + std::to_wstring(mNextLevelNum) + ".xml";
+    mNextLevelDocument = std::async(std::launch::async, [filename = mNextLevelFilename]()
+    {
+        auto xmlDoc = std::make_unique<wxXmlDocument>();
+        if (!xmlDoc->Load(filename))
+        {
+            // LoadNextLevel loads the file again, which reports the error
+            return std::unique_ptr<wxXmlDocument>();
+        }
+
+        return xmlDoc;
+    });
+}
+
+/**
+ * Build the items of the next level from its parsed file.
+ *
+ * The items go into mNextItems, so the current level keeps being shown
+ * until LoadNextLevel swaps them in. Waits for the parse if it isn't done.
+ */
+void Game::BuildNextLevel()
+{
+    auto xmlDoc = mNextLevelDocument.get();
+    if (xmlDoc == nullptr)
+    {
+        return;
+    }
+
+    mNextLevelWidth = mLevelWidth;
+    mNextLevelHeight = mLevelHeight;
+    ReadLevelSize(*xmlDoc, &mNextLevelWidth, &mNextLevelHeight);
+
+    mBuildingNextLevel = true;
+    LevelLoader loader(this);
+    loader.Load(*xmlDoc);
+    AddLevelBanner(mNextLevelFilename);
+    mBuildingNextLevel = false;
+
+    mNextLevelReady = true;
+}
+
+/**
+ * Throw away any next level loaded ahead of time
+ */
+void Game::DiscardNextLevel()
+{
+    if (mNextLevelDocument.valid())
+    {
+        mNextLevelDocument.get();
+    }
+
+    mNextItems.clear();
+    mNextArena = RecycleArena(mNextArena);
+    mNextLevelReady = false;
+}
+
+/**
+ * Move on to the next level.
+ *
+ * The level is normally already built by the time the delay after a
+ * level ends is over, so it only has to be swapped in.
+ */
 void Game::LoadNextLevel()
 {
     // move to next level
-    if (mCurrLevelNum < LastLevelNum)
+    mCurrLevelNum = GetNextLevelNum();
+
+    if (mNextLevelDocument.valid())
     {
-        mCurrLevelNum += 1;
+        BuildNextLevel();
+    }
+
+    if (mNextLevelReady && mNextLevelNum == mCurrLevelNum)
+    {
+        mRemovedItems.clear();
+        mRemovedWires.clear();
+        mItems.swap(mNextItems);
+        mArena.swap(mNextArena);
+        mLevelWidth = mNextLevelWidth;
+        mLevelHeight = mNextLevelHeight;
+        InvalidateStaticLayer();
     }
     else
     {
-        mCurrLevelNum = LastLevelNum;
+        wxString filename = L"resources/levels/level" + std::to_wstring(mCurrLevelNum) + ".xml";
+        LoadLevel(filename);
     }
-    wxString filename = L"resources/levels/level" + std::to_wstring(mCurrLevelNum) + ".xml";
-    LoadLevel(filename);
+
+    // The items of the finished level are released here
+    DiscardNextLevel();
 
     // Pass the accumulated game score to next level.
     ScoreboardVisitor scoreVisitor;
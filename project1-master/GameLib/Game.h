@@ -9,11 +9,16 @@
 #define GAME_H
 
 #include <memory>
+#include <future>
 
 #include "IDraggable.h"
 #include "ItemVisitor.h"
 #include "PinOutput.h"
 #include "ScoreUpdateVisitor.h"
+#include "RenderList.h"
+#include "LevelArena.h"
+#include "PinTable.h"
+#include "WireTable.h"
 
 class Item;
 
@@ -29,6 +34,23 @@ private:
 
     double mYOffset = 0; ///< The vertical offset of the game view
 
+    /// Every pin in the game, for the handles pins refer to each other with.
+    /// Declared before the items, so it is destroyed after their pins.
+    PinTable mPinTable;
+
+    /// The wires between the pins, also destroyed after the pins
+    WireTable mWireTable;
+
+    /// Memory the objects of the current level are made from. Declared before
+    /// anything that holds level objects, so it is destroyed after them.
+    std::shared_ptr<LevelArena> mArena = std::make_shared<LevelArena>();
+
+    /// Memory the next level is built in while the current one finishes
+    std::shared_ptr<LevelArena> mNextArena = std::make_shared<LevelArena>();
+
+    /// Arenas of cleared levels with objects still alive outside the game
+    std::vector<std::shared_ptr<LevelArena>> mRetiredArenas;
+
     std::vector<std::shared_ptr<Item>> mItems; ///< All the items that populate the game
 
     int mLevelWidth = 1150; ///< Width of the level in Virtual Pixels (This is just a default value)
@@ -43,15 +65,67 @@ private:
 
     bool mHasLevelEnded = false; ///< Indicates if the level has ended
 
-    int mGameScore = 0; ///< The games score
+    /// The next level's file, parsed on a worker thread while the level complete banner shows
+    std::future<std::unique_ptr<wxXmlDocument>> mNextLevelDocument;
+
+    wxString mNextLevelFilename; ///< File the next level is loaded from
+
+    int mNextLevelNum = 0; ///< Number of the level being loaded ahead of time
 
-    bool mWasItemHitThisCycle = 0; ///< The items hit by beam this visitor cycle
-    bool mWasItemPreviouslyHit = false; ///< Determines if an item was previously hit by veam
-    Product* mCurrentProduct = nullptr; ///< The current product under the beam
+    /// Items of the next level, built ahead of time and swapped in when the delay ends
+    std::vector<std::shared_ptr<Item>> mNextItems;
+
+    int mNextLevelWidth = 1150; ///< Width of the next level in Virtual Pixels
+
+    int mNextLevelHeight = 800; ///< Height of the next level in Virtual Pixels
+
+    bool mNextLevelReady = false; ///< Does mNextItems hold the whole next level?
+
+    bool mBuildingNextLevel = false; ///< Does Add put items into mNextItems instead of the current level?
+
+    int mGameScore = 0; ///< The games score
 
     std::wstring mText; ///< The text to display on banner
     bool mVisible = true; ///< Whether the banner is visible
 
+    /// The parts of the scene that never change during a level, rendered at the current window size
+    std::shared_ptr<wxBitmap> mStaticLayer;
+
+    /// Areas in virtual pixels that changed since the view last repainted
+    std::vector<wxRect2DDouble> mDirtyRects;
+
+    /// Does the whole view have to be repainted?
+    bool mAllDirty = true;
+
+    /// Commands the items record each frame, reused so drawing doesn't allocate
+    RenderList mRenderList;
+
+    /// Output pins whose wires are recorded this frame, reused like mRenderList
+    std::vector<PinOutput*> mWirePins;
+
+    /// Items to remove at the end of this tick
+    std::vector<Item*> mRemovedItems;
+
+    /// Output pins whose wires are to be removed at the end of this tick
+    std::vector<PinHandle> mRemovedWires;
+
+    void RenderStaticLayer(int width, int height);
+    void RecordWires(const wxRect2DDouble& area);
+
+    wxRect ToWindowRect(const wxRect2DDouble& rect);
+
+    void LoadCompiledLevel(const wxString& filename);
+    void AddLevelBanner(const wxString& filename);
+
+    std::shared_ptr<LevelArena> RecycleArena(const std::shared_ptr<LevelArena>& arena);
+
+    int GetNextLevelNum() const;
+    void StartNextLevel();
+    void BuildNextLevel();
+    void DiscardNextLevel();
+
+    void CompactItems();
+
 public:
     Game(); // Default constructor
 
@@ -66,9 +140,39 @@ public:
 
     void ClearLevel();
 
+    /**
+     * Get the memory new objects of the level being loaded are made from
+     * @return The level arena
+     */
+    LevelArena* GetLevelArena() { return mBuildingNextLevel ? mNextArena.get() : mArena.get(); }
+
+    /**
+     * Get the table of every pin in the game
+     * @return The pin table
+     */
+    PinTable& GetPinTable() { return mPinTable; }
+
+    /**
+     * Get the wires between the pins of the game
+     * @return The wire table
+     */
+    WireTable& GetWireTable() { return mWireTable; }
+
     //std::shared_ptr<Item> OnLeftDown(int x, int y);
 
-    void OnDraw(std::shared_ptr<wxGraphicsContext>& graphics, int width, int height); // Draw the game
+    void OnDraw(std::shared_ptr<wxGraphicsContext>& graphics, int width, int height,
+                const wxRegion& updateRegion = wxRegion()); // Draw the game
+
+    wxImage RenderImage(int width, int height);
+
+    void Invalidate(const wxRect2DDouble& rect);
+
+    /**
+     * Mark the whole view as needing to be repainted
+     */
+    void InvalidateAll() { mAllDirty = true; }
+
+    bool TakeDirtyRects(std::vector<wxRect>& rects);
 
     /**
      * Get the virtual pixel x values
@@ -84,10 +188,18 @@ public:
      */
     double GetVirtualPixelsY(int y) { return (y - mYOffset) / mScale; }
 
+    /**
+     * Get the scale the game is drawn at
+     * @return Device pixels per virtual pixel
+     */
+    double GetScale() const { return mScale; }
+
     void TryToCatch(PinOutput* pinOutput, wxPoint lineEnd);
     void Accept(ItemVisitor* visitor);
 
     void RemoveItem(Item* item);
+    void RemoveWires(PinOutput* pinOutput);
+    bool RemoveAt(double x, double y);
     void Update(double elapsed);
 
     /**
@@ -120,29 +232,17 @@ public:
     */
     void LoadNextLevel();
 
-    /**
-     * @brief set the value of mItemsHitThisCycle
-     *
-     * @param state
-     */
-    void SetItemHitThisCycle(bool state) { mWasItemHitThisCycle = state; }
-
-
-    /**
-     * @brief sets the bool of mWasItemPreviouslyHit to new state
-     *
-     * @param state
-     */
-    void SetItemPreviouslyHit(bool state) { mWasItemPreviouslyHit = state; }
+    void DrawEndBanner(wxGraphicsContext* graphics);
 
     /**
-     * @brief sets a new value for mCurrentProduct
-     *
-     * @param newProduct
+     * Discard the static layer so it is rendered again on the next draw,
+     * which repaints the whole view
      */
-    void SetCurrentProduct(Product* newProduct) { mCurrentProduct = newProduct; }
-
-    void DrawEndBanner(wxGraphicsContext* graphics);
+    void InvalidateStaticLayer()
+    {
+        mStaticLayer = nullptr;
+        mAllDirty = true;
+    }
 };
 
 
@@ -44,6 +44,7 @@ void GameView::Initialize(wxFrame* parent)
     Bind(wxEVT_PAINT, &GameView::OnPaint, this);
     Bind(wxEVT_LEFT_DOWN, &GameView::OnLeftDown, this);
     Bind(wxEVT_LEFT_UP, &GameView::OnLeftUp, this);
+    Bind(wxEVT_RIGHT_DOWN, &GameView::OnRightDown, this);
     Bind(wxEVT_MOTION, &GameView::OnMouseMove, this);
     Bind(wxEVT_TIMER, &GameView::OnTimer, this);
 
@@ -133,32 +134,22 @@ void GameView::OnLoadLevel(wxCommandEvent& event)
 
 /**
  * Paint event, draws the window
+ *
+ * Only the parts of the window that were invalidated are drawn.
  * @param event Paint event object
  */
 void GameView::OnPaint(wxPaintEvent& event)
 {
-    // Create a double buffered display context
+    // Create a double buffered display context. The game's static layer covers
+    // the whole window, so it isn't cleared first
     wxAutoBufferedPaintDC dc(this);
 
-    // Clear the image to black
-    wxBrush background(*wxBLACK);
-    dc.SetBackground(background);
-    // Clear the window
-    dc.Clear();
-
-    /// Compute the time that has elapsed
-    /// Since the last call to OnPaint
-    auto newTime = mStopWatch.Time();
-    auto elapsed = (double)(newTime - mTime) * 0.001;
-    mTime = newTime;
-
     // Create a graphics context
     auto gc = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(dc));
 
     // Tell the game class to draw
     wxRect rect = GetRect();
-    mGame.OnDraw(gc, rect.GetWidth(), rect.GetHeight());
-    mGame.Update(elapsed);
+    mGame.OnDraw(gc, rect.GetWidth(), rect.GetHeight(), GetUpdateRegion());
 }
 
 /**
@@ -179,8 +170,8 @@ void GameView::OnLeftDown(wxMouseEvent& event)
     // If the visitor handled the click, it means a button was clicked, so no need to move items
     if (visitor.WasButtonClicked())
     {
-        // Refresh to update the conveyor's start/stop state
-        Refresh();
+        // Repaint the conveyor's start/stop state
+        RefreshDirty();
         return;
     }
 
@@ -190,7 +181,7 @@ void GameView::OnLeftDown(wxMouseEvent& event)
     {
         // We have selected an item, move it to the end of the list of items
         mGrabbedItem->MoveToFront();
-        Refresh();
+        RefreshDirty();
     }
 }
 
@@ -203,6 +194,21 @@ void GameView::OnLeftUp(wxMouseEvent& event)
     OnMouseMove(event);
 }
 
+/**
+ * Handle the right mouse button down event. Right clicking a gate
+ * removes it, right clicking an output pin removes its wires.
+ * @param event
+ */
+void GameView::OnRightDown(wxMouseEvent& event)
+{
+    if (mGame.RemoveAt(mGame.GetVirtualPixelsX(event.GetX()), mGame.GetVirtualPixelsY(event.GetY())))
+    {
+        // Whatever is grabbed may belong to what is being removed
+        mGrabbedItem = nullptr;
+        RefreshDirty();
+    }
+}
+
 /**
 * Handle the mouse move event
 * @param event
@@ -226,8 +232,8 @@ void GameView::OnMouseMove(wxMouseEvent& event)
             mGrabbedItem = nullptr;
         }
 
-        // Force the screen to redraw
-        Refresh();
+        // Repaint where the item was and where it is now
+        RefreshDirty();
     }
 }
 
@@ -241,29 +247,29 @@ void GameView::OnAddGate(wxCommandEvent& event)
     switch (event.GetId())
     {
     case IDM_ADDANDGATE:
-        gate = make_shared<AndLogicGate>(&mGame);
+        gate = mGame.GetLevelArena()->Make<AndLogicGate>(&mGame);
         break;
 
     case IDM_ADDORGATE:
-        gate = make_shared<OrLogicGate>(&mGame);
+        gate = mGame.GetLevelArena()->Make<OrLogicGate>(&mGame);
         break;
 
     case IDM_ADDNOT:
-        gate = make_shared<NotLogicGate>(&mGame);
+        gate = mGame.GetLevelArena()->Make<NotLogicGate>(&mGame);
         break;
 
     case IDM_ADDSRFLIPFLOP:
         // Add SR Flip Flop gate
-        gate = make_shared<SRLogicGate>(&mGame);
+        gate = mGame.GetLevelArena()->Make<SRLogicGate>(&mGame);
         break;
 
     case IDM_ADDDFLIPFLOP:
-        gate = make_shared<DLogicGate>(&mGame);
+        gate = mGame.GetLevelArena()->Make<DLogicGate>(&mGame);
         break;
 
     case IDM_ADDXORGATE:
         // Add XOR Gate
-        gate = make_shared<XORLogicGate>(&mGame);
+        gate = mGame.GetLevelArena()->Make<XORLogicGate>(&mGame);
         break;
 
     default:
@@ -297,7 +303,32 @@ void GameView::OnShowControlPoints(wxCommandEvent& event)
  */
 void GameView::OnTimer(wxTimerEvent& event)
 {
-    Refresh();
+    /// Compute the time that has elapsed
+    /// Since the last update
+    auto newTime = mStopWatch.Time();
+    auto elapsed = (double)(newTime - mTime) * 0.001;
+    mTime = newTime;
+
+    mGame.Update(elapsed);
+    RefreshDirty();
+}
+
+/**
+ * Repaint only the parts of the window that changed in the game
+ */
+void GameView::RefreshDirty()
+{
+    std::vector<wxRect> dirty;
+    if (mGame.TakeDirtyRects(dirty))
+    {
+        Refresh();
+        return;
+    }
+
+    for (auto& rect : dirty)
+    {
+        RefreshRect(rect);
+    }
 }
 
 
@@ -316,5 +347,5 @@ void GameView::OnMouseClick(wxMouseEvent& event)
     // Ask the game to apply the visitor to all items
     mGame.Accept(&visitor);
 
-    Refresh(); // Refresh the screen to reflect state changes
+    RefreshDirty(); // Repaint the parts of the screen whose state changed
 }
@@ -27,12 +27,14 @@ private:
     void OnPaint(wxPaintEvent& event);
     void OnLeftDown(wxMouseEvent& event);
     void OnLeftUp(wxMouseEvent& event);
+    void OnRightDown(wxMouseEvent& event);
     void OnMouseMove(wxMouseEvent& event);
     void OnAddGate(wxCommandEvent& event);
     void OnShowControlPoints(wxCommandEvent& event);
     void OnLoadLevel(wxCommandEvent& event);
     void OnMouseClick(wxMouseEvent& event);
     void OnTimer(wxTimerEvent& event);
+    void RefreshDirty();
 
     /// Timer for animation
     wxTimer mTimer;
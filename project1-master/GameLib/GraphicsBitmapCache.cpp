@@ -0,0 +1,53 @@
+/**
+ * @file GraphicsBitmapCache.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "GraphicsBitmapCache.h"
+
+/// Converted bitmaps keyed by renderer and source bitmap
+std::map<std::pair<wxGraphicsRenderer*, const wxBitmap*>, GraphicsBitmapCache::Entry> GraphicsBitmapCache::mEntries;
+
+/**
+ * Get the native bitmap for a bitmap on the renderer of a graphics context,
+ * converting it the first time it is drawn with that renderer.
+ * @param graphics The graphics context we are drawing on
+ * @param bitmap The bitmap to draw
+ * @return Native bitmap that can be passed to DrawBitmap
+ */
+const wxGraphicsBitmap& GraphicsBitmapCache::Get(wxGraphicsContext* graphics, const std::shared_ptr<wxBitmap>& bitmap)
+{
+    auto key = std::make_pair(graphics->GetRenderer(), bitmap.get());
+    auto found = mEntries.find(key);
+    if (found == mEntries.end())
+    {
+        // Bitmaps like the static layer are replaced often, drop the ones that have gone
+        for (auto i = mEntries.begin(); i != mEntries.end();)
+        {
+            i = i->second.mSource.expired() ? mEntries.erase(i) : std::next(i);
+        }
+
+        found = mEntries.emplace(key, Entry()).first;
+    }
+
+    auto& entry = found->second;
+
+    // A different bitmap may have been allocated at the same address since we converted
+    if (entry.mGraphicsBitmap.IsNull() || entry.mSource.lock() != bitmap)
+    {
+        entry.mSource = bitmap;
+        entry.mGraphicsBitmap = graphics->CreateBitmap(*bitmap);
+    }
+
+    return entry.mGraphicsBitmap;
+}
+
+/**
+ * Release every converted bitmap. Call before wxWidgets shuts
+ * down the renderers the bitmaps were made by.
+ */
+void GraphicsBitmapCache::Clear()
+{
+    mEntries.clear();
+}
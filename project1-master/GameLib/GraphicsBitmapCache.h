@@ -0,0 +1,48 @@
+/**
+ * @file GraphicsBitmapCache.h
+ * @author Conner O'Sullivan
+ *
+ * Cache of native graphics bitmaps per graphics renderer
+ */
+
+#ifndef GRAPHICSBITMAPCACHE_H
+#define GRAPHICSBITMAPCACHE_H
+
+#include <map>
+#include <memory>
+#include <utility>
+
+/**
+ * Cache of native wxGraphicsBitmap objects per graphics renderer.
+ *
+ * Converting a wxBitmap into a renderer's native bitmap is the expensive
+ * part of drawing it, and DrawBitmap(wxBitmap) repeats that every call.
+ * Bitmaps shared through the ImageCache never change, so each one is
+ * converted once per renderer and reused until the source bitmap goes away.
+ * Entries for bitmaps that have gone are dropped when the next new
+ * bitmap is added.
+ */
+class GraphicsBitmapCache
+{
+private:
+    /// A converted bitmap and the source it was made from
+    struct Entry
+    {
+        std::weak_ptr<wxBitmap> mSource; ///< The bitmap this was converted from
+        wxGraphicsBitmap mGraphicsBitmap; ///< The native bitmap for the renderer
+    };
+
+    /// Converted bitmaps keyed by renderer and source bitmap
+    static std::map<std::pair<wxGraphicsRenderer*, const wxBitmap*>, Entry> mEntries;
+
+public:
+    /// Constructor (disabled), the cache is only used through its static members
+    GraphicsBitmapCache() = delete;
+
+    static const wxGraphicsBitmap& Get(wxGraphicsContext* graphics, const std::shared_ptr<wxBitmap>& bitmap);
+
+    static void Clear();
+};
+
+
+#endif //GRAPHICSBITMAPCACHE_H
@@ -0,0 +1,157 @@
+/**
+ * @file GraphicsResourceCache.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "GraphicsResourceCache.h"
+
+/// Fonts keyed by renderer, size, face, flags and colour
+std::map<std::tuple<wxGraphicsRenderer*, double, std::wstring, int, wxUint32>, wxGraphicsFont>
+GraphicsResourceCache::mFonts;
+
+/// System fonts keyed by renderer, system font and colour
+std::map<std::tuple<wxGraphicsRenderer*, int, wxUint32>, wxGraphicsFont> GraphicsResourceCache::mSystemFonts;
+
+/// Pens keyed by renderer, colour, width and style
+std::map<std::tuple<wxGraphicsRenderer*, wxUint32, int, int>, wxGraphicsPen> GraphicsResourceCache::mPens;
+
+/// Brushes keyed by renderer and colour
+std::map<std::pair<wxGraphicsRenderer*, wxUint32>, wxGraphicsBrush> GraphicsResourceCache::mBrushes;
+
+/// Width and height of measured text keyed by renderer, font and text
+std::map<std::tuple<wxGraphicsRenderer*, const void*, std::wstring>, std::pair<double, double>>
+GraphicsResourceCache::mTextExtents;
+
+/**
+ * Pack a colour, including its alpha, into a single key value
+ * @param colour The colour
+ * @return Key for the colour
+ */
+wxUint32 GraphicsResourceCache::ColourKey(const wxColour& colour)
+{
+    return (wxUint32(colour.Alpha()) << 24) | (wxUint32(colour.Blue()) << 16) |
+        (wxUint32(colour.Green()) << 8) | wxUint32(colour.Red());
+}
+
+/**
+ * Get a font for the renderer of a graphics context, the same
+ * font wxGraphicsContext::CreateFont would create.
+ * @param graphics The graphics context we are drawing on
+ * @param size Size of the font in pixels
+ * @param facename Name of the font face
+ * @param flags wxFONTFLAG values for the font
+ * @param colour Colour to draw text in
+ * @return Font that can be passed to SetFont
+ */
+const wxGraphicsFont& GraphicsResourceCache::GetFont(wxGraphicsContext* graphics, double size,
+                                                     const std::wstring& facename, int flags, const wxColour& colour)
+{
+    auto& font = mFonts[std::make_tuple(graphics->GetRenderer(), size, facename, flags, ColourKey(colour))];
+    if (font.IsNull())
+    {
+        font = graphics->CreateFont(size, facename, flags, colour);
+    }
+
+    return font;
+}
+
+/**
+ * Get a system font for the renderer of a graphics context
+ * @param graphics The graphics context we are drawing on
+ * @param font Which system font to use
+ * @param colour Colour to draw text in
+ * @return Font that can be passed to SetFont
+ */
+const wxGraphicsFont& GraphicsResourceCache::GetSystemFont(wxGraphicsContext* graphics, wxSystemFont font,
+                                                           const wxColour& colour)
+{
+    auto& graphicsFont = mSystemFonts[std::make_tuple(graphics->GetRenderer(), int(font), ColourKey(colour))];
+    if (graphicsFont.IsNull())
+    {
+        graphicsFont = graphics->CreateFont(wxSystemSettings::GetFont(font), colour);
+    }
+
+    return graphicsFont;
+}
+
+/**
+ * Get a pen for the renderer of a graphics context
+ * @param graphics The graphics context we are drawing on
+ * @param colour Colour of the pen
+ * @param width Width of the pen in pixels
+ * @param style Style of the pen
+ * @return Pen that can be passed to SetPen
+ */
+const wxGraphicsPen& GraphicsResourceCache::GetPen(wxGraphicsContext* graphics, const wxColour& colour, int width,
+                                                   wxPenStyle style)
+{
+    auto& pen = mPens[std::make_tuple(graphics->GetRenderer(), ColourKey(colour), width, int(style))];
+    if (pen.IsNull())
+    {
+        pen = graphics->CreatePen(wxPen(colour, width, style));
+    }
+
+    return pen;
+}
+
+/**
+ * Get a solid brush for the renderer of a graphics context
+ * @param graphics The graphics context we are drawing on
+ * @param colour Colour of the brush
+ * @return Brush that can be passed to SetBrush
+ */
+const wxGraphicsBrush& GraphicsResourceCache::GetBrush(wxGraphicsContext* graphics, const wxColour& colour)
+{
+    auto& brush = mBrushes[std::make_pair(graphics->GetRenderer(), ColourKey(colour))];
+    if (brush.IsNull())
+    {
+        brush = graphics->CreateBrush(wxBrush(colour));
+    }
+
+    return brush;
+}
+
+/**
+ * Get the size of a string of text, measuring it only the first
+ * time it is asked for in that font.
+ *
+ * Text is measured in user space, so the result doesn't depend on
+ * the scale the game is drawn at. The font must come from this cache
+ * and is left set on the graphics context.
+ * @param graphics The graphics context we are drawing on
+ * @param font Font the text is drawn in
+ * @param text The text to measure
+ * @param width Receives the width of the text
+ * @param height Receives the height of the text
+ */
+void GraphicsResourceCache::GetTextExtent(wxGraphicsContext* graphics, const wxGraphicsFont& font,
+                                          const std::wstring& text, double* width, double* height)
+{
+    graphics->SetFont(font);
+
+    auto key = std::make_tuple(graphics->GetRenderer(), (const void*)font.GetGraphicsData(), text);
+    auto found = mTextExtents.find(key);
+    if (found == mTextExtents.end())
+    {
+        wxDouble textWidth, textHeight;
+        graphics->GetTextExtent(text, &textWidth, &textHeight);
+        found = mTextExtents.emplace(key, std::make_pair(textWidth, textHeight)).first;
+    }
+
+    *width = found->second.first;
+    *height = found->second.second;
+}
+
+/**
+ * Release every cached font, pen, brush and text measurement. Call
+ * before wxWidgets shuts down the renderers they were made by.
+ */
+void GraphicsResourceCache::Clear()
+{
+    mTextExtents.clear();
+    mFonts.clear();
+    mSystemFonts.clear();
+    mPens.clear();
+    mBrushes.clear();
+}
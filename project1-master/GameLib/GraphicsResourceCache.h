@@ -0,0 +1,67 @@
+/**
+ * @file GraphicsResourceCache.h
+ * @author Conner O'Sullivan
+ *
+ * Cache of native graphics fonts, pens and brushes per graphics renderer
+ */
+
+#ifndef GRAPHICSRESOURCECACHE_H
+#define GRAPHICSRESOURCECACHE_H
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+
+/**
+ * Cache of native wxGraphicsFont, wxGraphicsPen and wxGraphicsBrush
+ * objects per graphics renderer.
+ *
+ * Setting a wxFont, wxPen or wxBrush on a graphics context creates a
+ * native object for it every call, and fonts are the most expensive to
+ * create. The game draws with a small fixed set of them, so each one is
+ * created the first time it is asked for and reused for every frame after.
+ * Text measured in one of these fonts is remembered the same way.
+ */
+class GraphicsResourceCache
+{
+private:
+    /// Fonts keyed by renderer, size, face, flags and colour
+    static std::map<std::tuple<wxGraphicsRenderer*, double, std::wstring, int, wxUint32>, wxGraphicsFont> mFonts;
+
+    /// System fonts keyed by renderer, system font and colour
+    static std::map<std::tuple<wxGraphicsRenderer*, int, wxUint32>, wxGraphicsFont> mSystemFonts;
+
+    /// Pens keyed by renderer, colour, width and style
+    static std::map<std::tuple<wxGraphicsRenderer*, wxUint32, int, int>, wxGraphicsPen> mPens;
+
+    /// Brushes keyed by renderer and colour
+    static std::map<std::pair<wxGraphicsRenderer*, wxUint32>, wxGraphicsBrush> mBrushes;
+
+    /// Width and height of measured text keyed by renderer, font and text
+    static std::map<std::tuple<wxGraphicsRenderer*, const void*, std::wstring>, std::pair<double, double>> mTextExtents;
+
+    static wxUint32 ColourKey(const wxColour& colour);
+
+public:
+    /// Constructor (disabled), the cache is only used through its static members
+    GraphicsResourceCache() = delete;
+
+    static const wxGraphicsFont& GetFont(wxGraphicsContext* graphics, double size, const std::wstring& facename,
+                                         int flags, const wxColour& colour);
+
+    static const wxGraphicsFont& GetSystemFont(wxGraphicsContext* graphics, wxSystemFont font, const wxColour& colour);
+
+    static const wxGraphicsPen& GetPen(wxGraphicsContext* graphics, const wxColour& colour, int width = 1,
+                                       wxPenStyle style = wxPENSTYLE_SOLID);
+
+    static const wxGraphicsBrush& GetBrush(wxGraphicsContext* graphics, const wxColour& colour);
+
+    static void GetTextExtent(wxGraphicsContext* graphics, const wxGraphicsFont& font, const std::wstring& text,
+                              double* width, double* height);
+
+    static void Clear();
+};
+
+
+#endif //GRAPHICSRESOURCECACHE_H
@@ -0,0 +1,154 @@
+/**
+ * @file ImageCache.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "ImageCache.h"
+
+#include <wx/dir.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/// All the files decoded so far
+std::map<std::wstring, ImageCache::Entry> ImageCache::mEntries;
+
+/**
+ * Find a file in the cache, decoding it the first time it is asked for
+ * @param filename Path of the image file
+ * @return The cache entry for the file
+ */
+ImageCache::Entry& ImageCache::Load(const std::wstring& filename)
+{
+    auto found = mEntries.find(filename);
+    if (found != mEntries.end())
+    {
+        return found->second;
+    }
+
+    Entry entry;
+    entry.mImage = make_shared<wxImage>(filename, wxBITMAP_TYPE_ANY);
+    entry.mBitmap = make_shared<wxBitmap>(*entry.mImage);
+    return mEntries.emplace(filename, entry).first->second;
+}
+
+/**
+ * Get the horizontally mirrored bitmap for a file.
+ *
+ * The mirror is made once from the cached image and shared after that.
+ * @param filename Path of the image file
+ * @return Shared mirrored bitmap
+ */
+std::shared_ptr<wxBitmap> ImageCache::GetMirroredBitmap(const std::wstring& filename)
+{
+    auto& entry = Load(filename);
+    if (entry.mMirroredBitmap == nullptr)
+    {
+        entry.mMirroredBitmap = make_shared<wxBitmap>(entry.mImage->Mirror());
+    }
+
+    return entry.mMirroredBitmap;
+}
+
+/**
+ * Decode every PNG image in a directory into the cache.
+ *
+ * The images are decoded on a pool of worker threads, so the wait is
+ * close to the time of the slowest image instead of the sum of them
+ * all. Bitmaps belong to the UI thread, so they are created from the
+ * decoded images on the calling thread once every worker is done.
+ * Files already in the cache are skipped.
+ * @param directory Directory containing the images, ending in a slash
+ * @param progress Called on the calling thread as images finish decoding
+ */
+void ImageCache::Preload(const std::wstring& directory, const Progress& progress)
+{
+    wxDir dir(directory);
+    if (!dir.IsOpened())
+    {
+        return;
+    }
+
+    // Use the same paths the items ask for
+    vector<wstring> filenames;
+    wxString name;
+    for (bool more = dir.GetFirst(&name, L"*.png", wxDIR_FILES); more; more = dir.GetNext(&name))
+    {
+        wstring filename = directory + name.ToStdWstring();
+        if (mEntries.find(filename) == mEntries.end())
+        {
+            filenames.push_back(filename);
+        }
+    }
+
+    vector<shared_ptr<wxImage>> images(filenames.size());
+    atomic<size_t> next(0);
+    size_t done = 0;
+    mutex doneMutex;
+    condition_variable doneChanged;
+
+    // Each worker takes the next file nobody has started on
+    auto decode = [&]()
+    {
+        for (size_t i = next++; i < filenames.size(); i = next++)
+        {
+            images[i] = make_shared<wxImage>(filenames[i], wxBITMAP_TYPE_ANY);
+
+            lock_guard<mutex> lock(doneMutex);
+            done++;
+            doneChanged.notify_one();
+        }
+    };
+
+    size_t threadCount = min<size_t>(max(1u, thread::hardware_concurrency()), filenames.size());
+    vector<thread> workers;
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        workers.emplace_back(decode);
+    }
+
+    // Report progress each time an image finishes
+    size_t reported = 0;
+    while (reported < filenames.size())
+    {
+        unique_lock<mutex> lock(doneMutex);
+        doneChanged.wait(lock, [&]() { return done > reported; });
+        reported = done;
+        lock.unlock();
+
+        if (progress)
+        {
+            progress(reported, filenames.size());
+        }
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < filenames.size(); i++)
+    {
+        Entry entry;
+        entry.mImage = images[i];
+        entry.mBitmap = make_shared<wxBitmap>(*entry.mImage);
+        mEntries.emplace(filenames[i], entry);
+    }
+}
+
+/**
+ * Drop every cached file.
+ *
+ * Items that still hold a shared image or bitmap keep it alive,
+ * it just isn't handed out again.
+ */
+void ImageCache::Clear()
+{
+    mEntries.clear();
+}
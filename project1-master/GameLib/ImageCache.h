@@ -0,0 +1,75 @@
+/**
+ * @file ImageCache.h
+ * @author Conner O'Sullivan
+ *
+ * Process-wide cache of decoded images and bitmaps
+ */
+
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+/**
+ * Process-wide cache of decoded images and bitmaps keyed by resource path.
+ *
+ * Each file is decoded the first time it is asked for. Every later
+ * request for the same path gets the same shared image and bitmap,
+ * so items only hold a reference instead of their own copy.
+ *
+ * Preload decodes a whole directory up front on several threads, so
+ * the items of a level find their images already decoded.
+ */
+class ImageCache
+{
+private:
+    /// A decoded image and the bitmap made from it
+    struct Entry
+    {
+        std::shared_ptr<wxImage> mImage; ///< The decoded image
+        std::shared_ptr<wxBitmap> mBitmap; ///< Bitmap created from the image
+        std::shared_ptr<wxBitmap> mMirroredBitmap; ///< Horizontally mirrored bitmap, created when first asked for
+    };
+
+    static Entry& Load(const std::wstring& filename);
+
+    /// All the files decoded so far
+    static std::map<std::wstring, Entry> mEntries;
+
+public:
+    /// Constructor (disabled), the cache is only used through its static members
+    ImageCache() = delete;
+
+    /**
+     * Get the decoded image for a file
+     * @param filename Path of the image file
+     * @return Shared decoded image
+     */
+    static std::shared_ptr<wxImage> GetImage(const std::wstring& filename) { return Load(filename).mImage; }
+
+    /**
+     * Get the bitmap for a file
+     * @param filename Path of the image file
+     * @return Shared bitmap
+     */
+    static std::shared_ptr<wxBitmap> GetBitmap(const std::wstring& filename) { return Load(filename).mBitmap; }
+
+    static std::shared_ptr<wxBitmap> GetMirroredBitmap(const std::wstring& filename);
+
+    /**
+     * Function told how many of the preloaded images are decoded so far
+     * @param done Number of images decoded
+     * @param total Number of images being preloaded
+     */
+    typedef std::function<void(size_t done, size_t total)> Progress;
+
+    static void Preload(const std::wstring& directory, const Progress& progress = Progress());
+
+    static void Clear();
+};
+
+
+#endif //IMAGECACHE_H
@@ -5,6 +5,8 @@
 
 #include "pch.h"
 #include "InputLogicGate.h"
+#include "Game.h"
+#include "RenderList.h"
 
 using namespace std;
 
@@ -23,26 +25,26 @@ InputLogicGate::InputLogicGate(Game* game) : LogicGate(game)
 {
     SetGateSize(InputGateSize);
     const wxPoint InputPinLocation((0), (0));
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation));
 }
 
 /**
- * @brief Draws the Input logic gate.
+ * @brief Records the Input logic gate.
  *
- * This function creates and draws the shape of the Input gate on the given
- * graphics context using Bezier curves.
+ * The input gate only has its pins to draw.
+ * @param list The render list to record into
  */
-void InputLogicGate::Draw(wxGraphicsContext* gc)
+void InputLogicGate::Record(RenderList* list)
 {
-    DrawPins(gc);
+    RecordPins(list);
 }
 
 State InputLogicGate::GetInputPinValue()
 {
     if (!GetPinInputs().empty())
     {
-        auto InputPins = GetPinInputs();
-        auto input = InputPins[0];
+        auto& InputPins = GetPinInputs();
+        auto& input = InputPins[0];
         return input->GetState();
     }
     return State::Unknown;
@@ -43,11 +43,11 @@ public:
     void operator=(const InputLogicGate&) = delete;
 
     /**
-     * @brief Draw the Input Logic Gate.
+     * @brief Record the Input Logic Gate.
      *
-     * @param gc Pointer to the wxGraphicsContext used for drawing.
+     * @param list The render list to record into.
      */
-    void Draw(wxGraphicsContext* gc) override;
+    void Record(RenderList* list) override;
 
     /**
     * Accept a visitor
@@ -7,6 +7,9 @@
 #include "Item.h"
 
 #include "Game.h"
+#include "ImageCache.h"
+#include "GraphicsBitmapCache.h"
+#include "RenderList.h"
 
 using namespace std;
 
@@ -17,8 +20,8 @@ using namespace std;
  */
 Item::Item(Game* game, const std::wstring& imageFilename) : mGame(game)
 {
-    mItemImage = make_unique<wxImage>(imageFilename, wxBITMAP_TYPE_ANY);
-    mItemBitmap = make_unique<wxBitmap>(*mItemImage);
+    mItemImage = ImageCache::GetImage(imageFilename);
+    mItemBitmap = ImageCache::GetBitmap(imageFilename);
 }
 
 /**
@@ -43,14 +46,25 @@ void Item::Draw(wxGraphicsContext* gc)
     double width = mItemBitmap->GetWidth();
     double height = mItemBitmap->GetHeight();
 
-    wxGraphicsBitmap graphicsBitmap = gc->CreateBitmap(*mItemBitmap);
-    gc->DrawBitmap(graphicsBitmap,
+    gc->DrawBitmap(GraphicsBitmapCache::Get(gc, mItemBitmap),
                    int(GetX() - width / 2),
                    int(GetY() - height / 2),
                    width,
                    height);
 }
 
+/**
+ * Record the commands that draw this item into a render list.
+ *
+ * By default the item draws itself with Draw when the list is replayed.
+ * Items that only draw bitmaps, shapes and text record those instead.
+ * @param list The render list to record into
+ */
+void Item::Record(RenderList* list)
+{
+    list->DrawItem(this);
+}
+
 /**
  * This draggable thing should be moved to the front
  * of the list of items.
@@ -60,10 +74,45 @@ void Item::MoveToFront()
     mGame->BringItemToFront(this);
 }
 
+/**
+ * Set the item location
+ *
+ * Both where the item was and where it is now are repainted.
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ */
 void Item::SetLocation(double x, double y)
 {
+    if (x == mX && y == mY)
+    {
+        return;
+    }
+
+    Invalidate();
     mX = x;
     mY = y;
+    Invalidate();
+}
+
+/**
+ * Get the area this item draws over
+ *
+ * The default is the item image centered on the item location.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Item::GetBounds()
+{
+    double width = GetWidth();
+    double height = GetHeight();
+    return wxRect2DDouble(GetX() - width / 2, GetY() - height / 2, width, height);
+}
+
+/**
+ * Tell the game the area this item draws over has to be repainted
+ */
+void Item::Invalidate()
+{
+    mGame->Invalidate(GetBounds());
 }
 
 
@@ -12,6 +12,7 @@
 
 class Game;
 class PinOutput;
+class RenderList;
 
 
 /**
@@ -28,11 +29,11 @@ private:
     double mX = 0; ///< X location for the center of the item
     double mY = 0; ///< Y location for the center of the item
 
-    /// The underlying item image
-    std::unique_ptr<wxImage> mItemImage;
+    /// The underlying item image, shared through the ImageCache
+    std::shared_ptr<wxImage> mItemImage;
 
-    /// The bitmap we can display for this item
-    std::unique_ptr<wxBitmap> mItemBitmap;
+    /// The bitmap we can display for this item, shared through the ImageCache
+    std::shared_ptr<wxBitmap> mItemBitmap;
 
 protected:
     Item(Game* game, const std::wstring& imageFilename);
@@ -70,6 +71,23 @@ public:
      */
     virtual void Draw(wxGraphicsContext* gc);
 
+    virtual void Record(RenderList* list);
+
+    /**
+     * Draw the parts of this item that never change while a level is played.
+     *
+     * The game renders these once into its static layer, which is
+     * composited under everything drawn by Draw. Only content that is
+     * below every item's Draw, such as the parts of items added before
+     * any moving item, or that no moving item ever overlaps, belongs here.
+     * @param gc Device context to draw on
+     */
+    virtual void DrawStatic(wxGraphicsContext* gc) {}
+
+    virtual wxRect2DDouble GetBounds();
+
+    void Invalidate();
+
     /**
      * Test this DRAGGABLE item to see if it has been clicked on
      * @param x X location on the game to test in pixels
@@ -100,13 +118,13 @@ public:
      * Get the item bitmap
      * @return the bitmap of the item object
      */
-    std::unique_ptr<wxBitmap>& GetItemBitmap() { return mItemBitmap; }
+    const std::shared_ptr<wxBitmap>& GetItemBitmap() { return mItemBitmap; }
 
     /**
      * Get the item bitmap
      * @return the bitmap of the item object
      */
-    std::unique_ptr<wxImage>& GetItemImage() { return mItemImage; }
+    const std::shared_ptr<wxImage>& GetItemImage() { return mItemImage; }
 
 
     void MoveToFront() override;
@@ -132,6 +150,11 @@ public:
     */
     virtual std::shared_ptr<IDraggable> HitDraggable(int x, int y) { return nullptr; }
 
+    /**
+     * Remove every wire to and from this item, as it is being removed from the game
+     */
+    virtual void Disconnect() {}
+
     /**
      * Get the pointer to the Game object
      * @return Pointer to Game object
@@ -0,0 +1,77 @@
+/**
+ * @file LevelArena.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "LevelArena.h"
+
+#include <algorithm>
+
+/// Size of the buffer a new arena starts with, in bytes
+const size_t InitialArenaSize = 64 * 1024;
+
+/**
+ * Constructor
+ */
+LevelArena::LevelArena() : mBuffer(new std::byte[InitialArenaSize]), mBufferSize(InitialArenaSize)
+{
+    mNext = mBuffer.get();
+    mSpace = mBufferSize;
+}
+
+/**
+ * Take memory for an object from the arena
+ * @param bytes Size of the object
+ * @param alignment Alignment of the object
+ * @return The memory
+ */
+void* LevelArena::Allocate(size_t bytes, size_t alignment)
+{
+    mLive++;
+    mUsed += bytes + alignment;
+
+    void* block = mNext;
+    if (std::align(alignment, bytes, block, mSpace) == nullptr)
+    {
+        // Out of room, bump through a block from the heap instead
+        size_t size = std::max(mBufferSize, bytes + alignment);
+        mOverflow.emplace_back(new std::byte[size]);
+        block = mOverflow.back().get();
+        mSpace = size;
+        std::align(alignment, bytes, block, mSpace);
+    }
+
+    mNext = static_cast<std::byte*>(block) + bytes;
+    mSpace -= bytes;
+    return block;
+}
+
+/**
+ * Free the memory of an object. The memory itself is only reused after Release.
+ */
+void LevelArena::Deallocate()
+{
+    mLive--;
+}
+
+/**
+ * Make all the arena's memory available again.
+ *
+ * Only call once every object made from the arena has been freed.
+ */
+void LevelArena::Release()
+{
+    mOverflow.clear();
+
+    // Grow the buffer so a level like the last one fits without the heap
+    if (mUsed > mBufferSize)
+    {
+        mBufferSize = mUsed;
+        mBuffer.reset(new std::byte[mBufferSize]);
+    }
+
+    mNext = mBuffer.get();
+    mSpace = mBufferSize;
+    mUsed = 0;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file LevelArena.h
+ * @author Conner O'Sullivan
+ *
+ * Memory that everything in one level is made from
+ */
+
+#ifndef LEVELARENA_H
+#define LEVELARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+template <class T> class LevelArenaAllocator;
+
+/**
+ * Memory that everything in one level is made from.
+ *
+ * Items, their pins and the other objects a level makes are allocated
+ * one after the other from a buffer, so loading a level is a series of
+ * pointer bumps and the objects of a level sit together in memory.
+ * Freeing an object only counts it. Once every object is gone, Release
+ * hands the whole buffer back to be used for the next level.
+ *
+ * If a level needed more than the buffer, the buffer is made large
+ * enough for it when released, so a level of the same size fits next
+ * time without going back to the heap.
+ *
+ * The arena bumps through its buffer itself rather than using
+ * std::pmr, which not every standard library we build with has.
+ */
+class LevelArena
+{
+private:
+    std::unique_ptr<std::byte[]> mBuffer; ///< The buffer objects are made in
+    size_t mBufferSize; ///< Size of mBuffer in bytes
+
+    /// Blocks taken from the heap once mBuffer ran out, kept until the next release
+    std::vector<std::unique_ptr<std::byte[]>> mOverflow;
+
+    std::byte* mNext = nullptr; ///< Next free byte of the block being bumped through
+    size_t mSpace = 0; ///< Bytes left in that block after mNext
+
+    size_t mLive = 0; ///< Number of objects made and not yet freed
+    size_t mUsed = 0; ///< Bytes handed out since the last release
+
+public:
+    LevelArena();
+
+    /// Copy constructor (disabled)
+    LevelArena(const LevelArena&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const LevelArena&) = delete;
+
+    void* Allocate(size_t bytes, size_t alignment);
+    void Deallocate();
+    void Release();
+
+    /**
+     * Get the number of objects made from the arena that are still alive
+     * @return Number of live objects
+     */
+    size_t GetLive() const { return mLive; }
+
+    /**
+     * Get the size of the buffer the arena starts each level with
+     * @return Size in bytes
+     */
+    size_t GetBufferSize() const { return mBufferSize; }
+
+    /**
+     * Make an object in the arena
+     * @tparam T Type of the object
+     * @tparam Args Types of the constructor arguments
+     * @param args Constructor arguments
+     * @return Shared pointer to the object, which gives its memory back to the arena when freed
+     */
+    template <class T, class... Args>
+    std::shared_ptr<T> Make(Args&&... args)
+    {
+        return std::allocate_shared<T>(LevelArenaAllocator<T>(this), std::forward<Args>(args)...);
+    }
+};
+
+/**
+ * Allocator that makes objects in a LevelArena. Used by LevelArena::Make,
+ * through std::allocate_shared, for the block that holds an object.
+ * @tparam T Type being allocated
+ */
+template <class T>
+class LevelArenaAllocator
+{
+private:
+    LevelArena* mArena; ///< The arena memory comes from
+
+public:
+    /// Type being allocated
+    typedef T value_type;
+
+    /**
+     * Constructor
+     * @param arena The arena memory comes from
+     */
+    explicit LevelArenaAllocator(LevelArena* arena) : mArena(arena)
+    {
+    }
+
+    /**
+     * Converting constructor, used when std::allocate_shared rebinds the allocator
+     * @tparam U Type the other allocator allocates
+     * @param other The allocator to share the arena of
+     */
+    template <class U>
+    LevelArenaAllocator(const LevelArenaAllocator<U>& other) : mArena(other.GetArena())
+    {
+    }
+
+    /**
+     * Allocate memory from the arena
+     * @param n Number of objects to allocate room for
+     * @return The memory
+     */
+    T* allocate(size_t n) { return static_cast<T*>(mArena->Allocate(n * sizeof(T), alignof(T))); }
+
+    /**
+     * Free memory. The arena only reuses it after a release.
+     * @param block The memory
+     * @param n Number of objects it had room for
+     */
+    void deallocate(T* block, size_t n) noexcept { mArena->Deallocate(); }
+
+    /**
+     * Get the arena memory comes from
+     * @return The arena
+     */
+    LevelArena* GetArena() const { return mArena; }
+};
+
+/**
+ * Arena allocators are interchangeable when they use the same arena
+ * @param a One allocator
+ * @param b The other allocator
+ * @return true if memory from one can be freed by the other
+ */
+template <class T, class U>
+bool operator==(const LevelArenaAllocator<T>& a, const LevelArenaAllocator<U>& b) { return a.GetArena() == b.GetArena(); }
+
+/**
+ * Arena allocators are interchangeable when they use the same arena
+ * @param a One allocator
+ * @param b The other allocator
+ * @return true if memory from one can't be freed by the other
+ */
+template <class T, class U>
+bool operator!=(const LevelArenaAllocator<T>& a, const LevelArenaAllocator<U>& b) { return !(a == b); }
+
+
+#endif //LEVELARENA_H
@@ -0,0 +1,285 @@
+/**
+ * @file LevelCompiler.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "LevelCompiler.h"
+#include "CompiledLevel.h"
+#include "Product.h"
+
+#include <wx/file.h>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Read a pair of numbers separated by a comma, such as "60,-390"
+ * @param node The node the attribute is on
+ * @param name Name of the attribute
+ * @param defaultValue Value to use if the attribute is missing
+ * @param first Receives the first number
+ * @param second Receives the second number
+ */
+static void GetPair(wxXmlNode* node, const wxString& name, const wxString& defaultValue,
+                    double* first, double* second)
+{
+    wxArrayString parts = wxSplit(node->GetAttribute(name, defaultValue), ',');
+    if (parts.GetCount() == 2)
+    {
+        parts[0].ToDouble(first);
+        parts[1].ToDouble(second);
+    }
+}
+
+/**
+ * Read a number attribute
+ * @param node The node the attribute is on
+ * @param name Name of the attribute
+ * @param defaultValue Value to use if the attribute is missing
+ * @return The value of the attribute
+ */
+static double GetDouble(wxXmlNode* node, const wxString& name, const wxString& defaultValue)
+{
+    double value = 0;
+    node->GetAttribute(name, defaultValue).ToDouble(&value);
+    return value;
+}
+
+/**
+ * Read a whole number attribute
+ * @param node The node the attribute is on
+ * @param name Name of the attribute
+ * @param defaultValue Value to use if the attribute is missing
+ * @return The value of the attribute
+ */
+static long GetLong(wxXmlNode* node, const wxString& name, const wxString& defaultValue)
+{
+    long value = 0;
+    node->GetAttribute(name, defaultValue).ToLong(&value);
+    return value;
+}
+
+/**
+ * Look up a product property by its name in the XML
+ * @param name Name of the property
+ * @param property Receives the property
+ * @return true if the name is a property
+ */
+static bool GetProperty(const wxString& name, wxUint8* property)
+{
+    auto found = Product::NamesToProperties.find(name.ToStdWstring());
+    if (found == Product::NamesToProperties.end())
+    {
+        return false;
+    }
+
+    *property = wxUint8(found->second);
+    return true;
+}
+
+/**
+ * Compile a level XML file
+ * @param xmlFilename The level XML file
+ * @param filename The compiled level file to write
+ * @return true if the level was compiled
+ */
+bool LevelCompiler::Compile(const wxString& xmlFilename, const wxString& filename)
+{
+    wxXmlDocument xmlDoc;
+    if (!xmlDoc.Load(xmlFilename))
+    {
+        return false;
+    }
+
+    return Compile(xmlDoc, filename);
+}
+
+/**
+ * Compile a parsed level XML file.
+ *
+ * Items are read the same way their XmlLoad functions and the
+ * LevelLoader read them, with products placed as they are when a
+ * level is loaded into a game that hasn't been drawn yet.
+ * @param xmlDoc The parsed level
+ * @param filename The compiled level file to write
+ * @return true if the level was compiled
+ */
+bool LevelCompiler::Compile(const wxXmlDocument& xmlDoc, const wxString& filename)
+{
+    auto root = xmlDoc.GetRoot();
+    if (root == nullptr)
+    {
+        return false;
+    }
+
+    CompiledLevelHeader header = {};
+    memcpy(header.mMagic, CompiledLevelMagic, sizeof(header.mMagic));
+    header.mVersion = CompiledLevelVersion;
+
+    double width = 1150, height = 800;
+    GetPair(root, L"size", L"1150,800", &width, &height);
+    header.mWidth = wxInt32(width);
+    header.mHeight = wxInt32(height);
+
+    vector<CompiledItem> items;
+    vector<CompiledProduct> products;
+    vector<wxUint8> outputs;
+    string text;
+
+    for (auto child = root->GetChildren(); child; child = child->GetNext())
+    {
+        if (child->GetName() != L"items")
+        {
+            continue;
+        }
+
+        for (auto node = child->GetChildren(); node; node = node->GetNext())
+        {
+            auto name = node->GetName();
+
+            CompiledItem item = {};
+            item.mX = int(GetLong(node, L"x", L"0"));
+            item.mY = int(GetLong(node, L"y", L"0"));
+
+            if (name == L"sensor")
+            {
+                item.mType = wxUint32(CompiledItemType::Sensor);
+                item.mFirst = wxUint32(outputs.size());
+                for (auto output = node->GetChildren(); output; output = output->GetNext())
+                {
+                    wxUint8 property;
+                    if (!GetProperty(output->GetName(), &property))
+                    {
+                        return false;
+                    }
+
+                    outputs.push_back(property);
+                }
+                item.mCount = wxUint32(outputs.size()) - item.mFirst;
+            }
+            else if (name == L"conveyor")
+            {
+                item.mType = wxUint32(CompiledItemType::Conveyor);
+                item.mParameters[0] = GetLong(node, L"speed", L"0");
+                item.mParameters[1] = GetDouble(node, L"height", L"0");
+                double panelX = 0, panelY = 0;
+                GetPair(node, L"panel", L"0,0", &panelX, &panelY);
+                item.mParameters[2] = int(panelX);
+                item.mParameters[3] = int(panelY);
+
+                // Products are placed up the conveyor, each relative to the conveyor or to the one before
+                item.mFirst = wxUint32(products.size());
+                double lastProductY = item.mY;
+                for (auto productNode = node->GetChildren(); productNode; productNode = productNode->GetNext())
+                {
+                    // Generated products are made as the level runs, which the format can't describe
+                    if (productNode->GetName() == L"generator")
+                    {
+                        return false;
+                    }
+
+                    if (productNode->GetName() != L"product")
+                    {
+                        continue;
+                    }
+
+                    CompiledProduct product = {};
+                    if (!GetProperty(productNode->GetAttribute(L"shape", L"square"), &product.mShape) ||
+                        !GetProperty(productNode->GetAttribute(L"color", L"red"), &product.mColor) ||
+                        !GetProperty(productNode->GetAttribute(L"content", L"none"), &product.mContent))
+                    {
+                        return false;
+                    }
+                    product.mKick = productNode->GetAttribute(L"kick", L"no") == L"yes" ? 1 : 0;
+
+                    // The loader converts placements to virtual pixels as whole numbers
+                    auto placement = productNode->GetAttribute(L"placement", L"0");
+                    double offset = 0;
+                    placement.ToDouble(&offset);
+                    offset = int(offset);
+                    if (placement.StartsWith("+"))
+                    {
+                        lastProductY -= offset;
+                    }
+                    else
+                    {
+                        lastProductY = item.mY - offset;
+                    }
+
+                    product.mX = item.mX;
+                    product.mY = lastProductY;
+                    products.push_back(product);
+                }
+                item.mCount = wxUint32(products.size()) - item.mFirst;
+            }
+            else if (name == L"beam")
+            {
+                item.mType = wxUint32(CompiledItemType::Beam);
+                item.mParameters[0] = GetLong(node, L"sender", L"0");
+            }
+            else if (name == L"sparty")
+            {
+                item.mType = wxUint32(CompiledItemType::Sparty);
+                item.mParameters[0] = GetDouble(node, L"height", L"0");
+                double pinX = 0, pinY = 0;
+                GetPair(node, L"pin", L"", &pinX, &pinY);
+                item.mParameters[1] = int(pinX);
+                item.mParameters[2] = int(pinY);
+                item.mParameters[3] = GetDouble(node, L"kick-duration", L"0");
+                item.mParameters[4] = GetDouble(node, L"kick-speed", L"0");
+            }
+            else if (name == L"scoreboard")
+            {
+                item.mType = wxUint32(CompiledItemType::Scoreboard);
+                item.mParameters[0] = GetLong(node, L"good", L"10");
+                item.mParameters[1] = GetLong(node, L"bad", L"0");
+
+                // The goal is the text of the scoreboard with each <br/> as a new line
+                wxString goal;
+                for (auto goalNode = node->GetChildren(); goalNode; goalNode = goalNode->GetNext())
+                {
+                    if (goalNode->GetType() == wxXML_TEXT_NODE)
+                    {
+                        goal += goalNode->GetContent();
+                    }
+                    else if (goalNode->GetName() == L"br")
+                    {
+                        goal += L"\n";
+                    }
+                }
+
+                auto utf8 = goal.utf8_str();
+                item.mFirst = wxUint32(text.size());
+                text.append(utf8.data(), utf8.length());
+                item.mCount = wxUint32(text.size()) - item.mFirst;
+            }
+            else
+            {
+                // The loader doesn't know any other items either
+                continue;
+            }
+
+            items.push_back(item);
+        }
+    }
+
+    header.mItemCount = wxUint32(items.size());
+    header.mProductCount = wxUint32(products.size());
+    header.mOutputCount = wxUint32(outputs.size());
+    header.mTextLength = wxUint32(text.size());
+
+    wxFile file;
+    if (!file.Create(filename, true))
+    {
+        return false;
+    }
+
+    return file.Write(&header, sizeof(header)) == sizeof(header) &&
+        file.Write(items.data(), items.size() * sizeof(CompiledItem)) == items.size() * sizeof(CompiledItem) &&
+        file.Write(products.data(), products.size() * sizeof(CompiledProduct)) ==
+        products.size() * sizeof(CompiledProduct) &&
+        file.Write(outputs.data(), outputs.size()) == outputs.size() &&
+        file.Write(text.data(), text.size()) == text.size();
+}
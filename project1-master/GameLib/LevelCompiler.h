@@ -0,0 +1,31 @@
+/**
+ * @file LevelCompiler.h
+ * @author Conner O'Sullivan
+ *
+ * Converts level XML files into the binary compiled level format
+ */
+
+#ifndef LEVELCOMPILER_H
+#define LEVELCOMPILER_H
+
+/**
+ * Converts level XML files into the binary compiled level format
+ * described in CompiledLevel.h.
+ *
+ * Everything the XML describes as text is resolved while compiling:
+ * product properties and sensor outputs become Product::Properties
+ * values and product placements become absolute locations, so a
+ * compiled level can be loaded without parsing any strings.
+ */
+class LevelCompiler
+{
+public:
+    /// Constructor (disabled), the compiler is only used through its static members
+    LevelCompiler() = delete;
+
+    static bool Compile(const wxString& xmlFilename, const wxString& filename);
+    static bool Compile(const wxXmlDocument& xmlDoc, const wxString& filename);
+};
+
+
+#endif //LEVELCOMPILER_H
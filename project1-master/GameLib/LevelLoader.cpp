@@ -13,6 +13,12 @@
 #include "Item.h"
 #include "Product.h"
 #include "Scoreboard.h"
+#include "ProductGenerator.h"
+#include "ProductPool.h"
+#include "CompiledLevel.h"
+#include "MappedFile.h"
+
+#include <cstring>
 
 /**
  * LevelLoader constructor
@@ -23,18 +29,11 @@ LevelLoader::LevelLoader(Game* game) : mGame(game)
 }
 
 /**
- * Load the file
- * @param filename The filename we are loading from
+ * Load the items of a level from its parsed file
+ * @param xmlDoc The level file, already parsed by the game
  */
-void LevelLoader::Load(const wxString& filename)
+void LevelLoader::Load(const wxXmlDocument& xmlDoc)
 {
-    wxXmlDocument xmlDoc;
-    if (!xmlDoc.Load(filename))
-    {
-        wxMessageBox(L"Unable to load level file");
-        return;
-    }
-
     auto root = xmlDoc.GetRoot();
 
     auto child = root->GetChildren();
@@ -48,6 +47,173 @@ void LevelLoader::Load(const wxString& filename)
     }
 }
 
+/**
+ * Is a mapped file a compiled level this loader can read?
+ *
+ * Checks the header and that every table it describes is inside the
+ * file, so Load can read the tables in place.
+ * @param file The mapped file
+ * @return true if the file is a compiled level
+ */
+bool LevelLoader::IsCompiledLevel(const MappedFile& file)
+{
+    if (!file.IsOk() || file.GetSize() < sizeof(CompiledLevelHeader))
+    {
+        return false;
+    }
+
+    auto header = reinterpret_cast<const CompiledLevelHeader*>(file.GetData());
+    if (memcmp(header->mMagic, CompiledLevelMagic, sizeof(header->mMagic)) != 0 ||
+        header->mVersion != CompiledLevelVersion)
+    {
+        return false;
+    }
+
+    // Sizes are added as 64 bit values so a corrupt count can't wrap around
+    wxUint64 size = sizeof(CompiledLevelHeader) +
+        wxUint64(header->mItemCount) * sizeof(CompiledItem) +
+        wxUint64(header->mProductCount) * sizeof(CompiledProduct) +
+        wxUint64(header->mOutputCount) + wxUint64(header->mTextLength);
+    return size <= file.GetSize();
+}
+
+/**
+ * Is a value from a compiled level a valid product property?
+ * @param value The stored value
+ * @return true if the value is a Product::Properties
+ */
+static bool IsProperty(wxUint8 value)
+{
+    return value <= wxUint8(Product::Properties::Basketball);
+}
+
+/**
+ * Load the items of a compiled level.
+ *
+ * The tables are read in place from the mapped file and the items are
+ * created in the same order the XML loader creates them. The file must
+ * have been checked with IsCompiledLevel. Items whose ranges fall
+ * outside the tables are skipped.
+ * @param file The mapped compiled level
+ */
+void LevelLoader::Load(const MappedFile& file)
+{
+    auto header = reinterpret_cast<const CompiledLevelHeader*>(file.GetData());
+    auto items = reinterpret_cast<const CompiledItem*>(header + 1);
+    auto products = reinterpret_cast<const CompiledProduct*>(items + header->mItemCount);
+    auto outputs = reinterpret_cast<const wxUint8*>(products + header->mProductCount);
+    auto text = reinterpret_cast<const char*>(outputs + header->mOutputCount);
+
+    auto inRange = [](const CompiledItem& item, wxUint32 count)
+    {
+        return item.mFirst <= count && item.mCount <= count - item.mFirst;
+    };
+
+    for (wxUint32 i = 0; i < header->mItemCount; i++)
+    {
+        const auto& item = items[i];
+        const auto* parameters = item.mParameters;
+
+        switch (CompiledItemType(item.mType))
+        {
+        case CompiledItemType::Sensor:
+            {
+                if (!inRange(item, header->mOutputCount))
+                {
+                    break;
+                }
+
+                auto sensor = mGame->GetLevelArena()->Make<Sensor>(mGame, std::vector<std::wstring>());
+                sensor->SetLocation(item.mX, item.mY);
+                for (wxUint32 o = item.mFirst; o < item.mFirst + item.mCount; o++)
+                {
+                    auto property = Product::Properties(outputs[o]);
+                    if (Product::PropertiesToTypes.count(property) != 0)
+                    {
+                        sensor->AddOutput(property);
+                    }
+                }
+
+                mGame->Add(sensor);
+            }
+            break;
+
+        case CompiledItemType::Conveyor:
+            {
+                if (!inRange(item, header->mProductCount))
+                {
+                    break;
+                }
+
+                auto conveyor = mGame->GetLevelArena()->Make<Conveyor>(mGame, int(parameters[0]), parameters[1],
+                                                                       wxPoint(int(parameters[2]), int(parameters[3])));
+                conveyor->SetLocation(item.mX, item.mY);
+                mGame->Add(conveyor);
+
+                std::shared_ptr<Product> lastProduct = nullptr;
+                for (wxUint32 p = item.mFirst; p < item.mFirst + item.mCount; p++)
+                {
+                    const auto& compiled = products[p];
+                    if (!IsProperty(compiled.mShape) || !IsProperty(compiled.mColor) ||
+                        !IsProperty(compiled.mContent))
+                    {
+                        continue;
+                    }
+
+                    auto product = ProductPool::Make(mGame, Product::Properties(compiled.mShape),
+                                                     Product::Properties(compiled.mColor),
+                                                     Product::Properties(compiled.mContent),
+                                                     compiled.mKick != 0);
+                    product->SetLocation(compiled.mX, compiled.mY);
+                    product->SetInitialPosition(compiled.mX, compiled.mY);
+                    mGame->Add(product);
+                    lastProduct = product;
+                }
+
+                // Tell the last product that it is last
+                if (lastProduct != nullptr)
+                {
+                    lastProduct->SetLast();
+                }
+            }
+            break;
+
+        case CompiledItemType::Beam:
+            {
+                auto beam = mGame->GetLevelArena()->Make<Beam>(mGame, int(parameters[0]));
+                beam->SetLocation(item.mX, item.mY);
+                mGame->Add(beam);
+            }
+            break;
+
+        case CompiledItemType::Sparty:
+            {
+                auto sparty = mGame->GetLevelArena()->Make<Sparty>(mGame, parameters[0],
+                                                                   wxPoint(int(parameters[1]), int(parameters[2])),
+                                                                   parameters[3], parameters[4]);
+                sparty->SetLocation(item.mX, item.mY);
+                mGame->Add(sparty);
+            }
+            break;
+
+        case CompiledItemType::Scoreboard:
+            {
+                if (!inRange(item, header->mTextLength))
+                {
+                    break;
+                }
+
+                std::wstring goal = wxString::FromUTF8(text + item.mFirst, item.mCount).ToStdWstring();
+                auto scoreboard = mGame->GetLevelArena()->Make<Scoreboard>(mGame, int(item.mX), int(item.mY),
+                                                                           int(parameters[0]), int(parameters[1]),
+                                                                           0, goal);
+                mGame->Add(scoreboard);
+            }
+            break;
+        }
+    }
+}
+
 /**
  * Load all items within the XML
  * @param node The node we are loading items from
@@ -72,24 +238,24 @@ void LevelLoader::XmlItem(wxXmlNode* node)
 
     if (name == L"sparty")
     {
-        item = std::make_shared<Sparty>(mGame, 0, wxPoint(0, 0), 0, 0);
+        item = mGame->GetLevelArena()->Make<Sparty>(mGame, 0, wxPoint(0, 0), 0, 0);
     }
     else if (name == L"sensor")
     {
-        item = std::make_shared<Sensor>(mGame, std::vector<std::wstring>());
+        item = mGame->GetLevelArena()->Make<Sensor>(mGame, std::vector<std::wstring>());
     }
     else if (name == L"beam")
     {
-        item = std::make_shared<Beam>(mGame, 0);
+        item = mGame->GetLevelArena()->Make<Beam>(mGame, 0);
     }
     else if (name == L"conveyor")
     {
-        item = std::make_shared<Conveyor>(mGame, 0, 0, wxPoint(0, 0));
+        item = mGame->GetLevelArena()->Make<Conveyor>(mGame, 0, 0, wxPoint(0, 0));
     }
     else if (name == L"scoreboard")
     {
         std::wstring emptyGoal;
-        item = std::make_shared<Scoreboard>(mGame, 0, 0, 10, 0, 0, emptyGoal);
+        item = mGame->GetLevelArena()->Make<Scoreboard>(mGame, 0, 0, 10, 0, 0, emptyGoal);
     }
 
     if (item)
@@ -115,15 +281,20 @@ void LevelLoader::LoadConveyorProducts(const std::shared_ptr<Item>& conveyor, wx
 {
     double lastProductY = conveyor->GetY(); // Get the Y position of the conveyor
     std::shared_ptr<Product> lastProduct = nullptr;
+    wxXmlNode* generatorNode = nullptr;
 
     for (wxXmlNode* child = node->GetChildren(); child; child = child->GetNext())
     {
-        if (child->GetName() == L"product")
+        if (child->GetName() == L"generator")
+        {
+            generatorNode = child;
+        }
+        else if (child->GetName() == L"product")
         {
             // Create the product
-            auto product = std::make_shared<Product>(mGame, Product::Properties::Square,
-                                                     Product::Properties::Green,
-                                                     Product::Properties::Izzo, false);
+            auto product = ProductPool::Make(mGame, Product::Properties::Square,
+                                             Product::Properties::Green,
+                                             Product::Properties::Izzo, false);
             product->XmlLoad(child);
 
             // If placement starts with "+", offset from last product
@@ -145,6 +316,17 @@ void LevelLoader::LoadConveyorProducts(const std::shared_ptr<Item>& conveyor, wx
         }
     }
 
+    // A generator makes the products after these, so none of these are last
+    if (generatorNode != nullptr)
+    {
+        auto generatorConveyor = std::static_pointer_cast<Conveyor>(conveyor);
+        auto generator = mGame->GetLevelArena()->Make<ProductGenerator>(mGame, generatorConveyor.get());
+        generator->XmlLoad(generatorNode);
+        generator->AddProducts();
+        generatorConveyor->SetGenerator(generator);
+        return;
+    }
+
     // Tell the last product that it is last
     if (lastProduct != nullptr)
     {
@@ -9,14 +9,19 @@
 #define LEVELLOADER_H
 #include "Game.h"
 
+class MappedFile;
+
 /**
- * Class responsible for loading levels from XML files.
+ * Class responsible for loading levels from XML files
+ * and from compiled level files.
  */
 class LevelLoader
 {
 public:
     LevelLoader(Game* game);
-    void Load(const wxString& filename);
+    void Load(const wxXmlDocument& xmlDoc);
+    void Load(const MappedFile& file);
+    static bool IsCompiledLevel(const MappedFile& file);
     void XmlItems(wxXmlNode* node);
     void XmlItem(wxXmlNode* node);
     void LoadConveyorProducts(const std::shared_ptr<Item>& conveyor, wxXmlNode* node);
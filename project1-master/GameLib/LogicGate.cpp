@@ -12,6 +12,7 @@
 #include "LogicGate.h"
 #include "PinInput.h"
 #include "PinOutput.h"
+#include "RenderList.h"
 
 
 /**
@@ -24,25 +25,49 @@ LogicGate::LogicGate(Game* game) : Item(game)
 }
 
 /**
- * @brief Create the pins for the logic gate.
- *
- * This function creates the input and output pins for the logic gate.
- * It equally spaces the pins by dividing the gate height into 2n parts,
- * placing the pins at odd-numbered positions.
- *
- * @param graphics the graphic context we're drawing on
+ * Draw the logic gate by recording it and replaying the recording
+ * @param graphics The graphics context to draw on
  */
-void LogicGate::DrawPins(wxGraphicsContext* graphics)
+void LogicGate::Draw(wxGraphicsContext* graphics)
 {
-    for (auto input : mInputPins)
+    RenderList list;
+    Record(&list);
+    list.Replay(graphics);
+}
+
+/**
+ * Record the pins on the logic gate
+ * @param list The render list to record into
+ */
+void LogicGate::RecordPins(RenderList* list)
+{
+    for (auto& input : mInputPins)
     {
-        input->Draw(graphics);
+        input->Record(list);
     }
 
-    for (auto output : mOutputPins)
+    for (auto& output : mOutputPins)
+    {
+        output->Record(list);
+    }
+}
+
+/**
+ * Give each input pin the state of the output pin wired to it
+ * @return true if any input changed state
+ */
+bool LogicGate::UpdateInputs()
+{
+    bool changed = false;
+    for (auto& input : mInputPins)
     {
-        output->Draw(graphics);
+        if (input->UpdateState())
+        {
+            changed = true;
+        }
     }
+
+    return changed;
 }
 
 /**
@@ -89,6 +114,68 @@ bool LogicGate::HitTest(int x, int y)
     return true;
 }
 
+/**
+ * Get the area the gate draws over, including its pins
+ * and the wires leaving its output pins.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble LogicGate::GetBounds()
+{
+    wxRect2DDouble bounds(GetX() - GetWidth() / 2, GetY() - GetHeight() / 2, GetWidth(), GetHeight());
+
+    for (auto& input : mInputPins)
+    {
+        bounds.Union(input->GetBounds());
+    }
+
+    for (auto& output : mOutputPins)
+    {
+        bounds.Union(output->GetBounds());
+    }
+
+    return bounds;
+}
+
+/**
+ * Set the location of the gate.
+ *
+ * The wires into the gate belong to the gates driving them,
+ * so those are repainted along with this one.
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ */
+void LogicGate::SetLocation(double x, double y)
+{
+    InvalidateDrivers();
+    Item::SetLocation(x, y);
+    InvalidateDrivers();
+
+    for (auto& output : mOutputPins)
+    {
+        output->SetWiresDirty();
+    }
+}
+
+/**
+ * Repaint the gates whose wires come into this one and
+ * have them lay those wires out again
+ */
+void LogicGate::InvalidateDrivers()
+{
+    for (auto& input : mInputPins)
+    {
+        auto line = input->GetLine();
+        if (line != nullptr)
+        {
+            line->SetWiresDirty();
+            if (line->GetOwner() != nullptr)
+            {
+                line->GetOwner()->Invalidate();
+            }
+        }
+    }
+}
+
 /**
  * Try to catch a wire at the new x,y location of the pin end
  * @param pinOutput PinOutput we are trying to catch from
@@ -109,3 +196,19 @@ bool LogicGate::Catch(PinOutput* pinOutput, wxPoint lineEnd)
     }
     return false;
 }
+
+/**
+ * Remove every wire to and from the gate's pins
+ */
+void LogicGate::Disconnect()
+{
+    for (auto& input : mInputPins)
+    {
+        input->Disconnect();
+    }
+
+    for (auto& output : mOutputPins)
+    {
+        output->Disconnect();
+    }
+}
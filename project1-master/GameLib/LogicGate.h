@@ -48,6 +48,8 @@ private:
     /// Vector containing output pins
     std::vector<std::shared_ptr<PinOutput>> mOutputPins;
 
+    void InvalidateDrivers();
+
 public:
     /// Virtual destructor
     virtual ~LogicGate();
@@ -55,14 +57,16 @@ public:
     /// Copy constructor (disabled)
     LogicGate(const LogicGate&) = delete;
 
+    void Draw(wxGraphicsContext* graphics) override;
+
     /**
-     * @brief Draws the logic gate on the provided graphics context.
+     * @brief Records the commands that draw the logic gate.
      *
      * This pure virtual function must be implemented by derived classes to render the logic gate.
      *
-     * @param graphics The graphics context used for drawing.
+     * @param list The render list to record into.
      */
-    void Draw(wxGraphicsContext* graphics) override = 0;
+    void Record(RenderList* list) override = 0;
 
     std::shared_ptr<IDraggable> HitDraggable(int x, int y) override;
 
@@ -82,8 +86,14 @@ public:
 
     bool HitTest(int x, int y) override;
 
+    wxRect2DDouble GetBounds() override;
+
+    void SetLocation(double x, double y) override;
+
     bool Catch(PinOutput* pinOutput, wxPoint lineEnd) override;
 
+    void Disconnect() override;
+
     /**
      * Accept a visitor
      *
@@ -116,6 +126,20 @@ public:
     */
     virtual void ComputeOutput() {};
 
+    /**
+    * @brief Retrieves the output pins of the item.
+    * @return A vector of shared pointers to the output pins.
+    */
+    const std::vector<std::shared_ptr<PinOutput>>& GetOutputPins() {return mOutputPins;}
+
+    /**
+    * @brief Retrieves the input pins of the item.
+    * @return A vector of shared pointers to the input pins.
+    */
+    const std::vector<std::shared_ptr<PinInput>>& GetPinInputs() { return mInputPins; }
+
+    bool UpdateInputs();
+
 
 protected:
     LogicGate(Game* game);
@@ -130,8 +154,8 @@ protected:
      */
     void SetGateSize(wxSize size) { mGateSize = size; }
 
-    /// Draws the pins on the logic gate
-    void DrawPins(wxGraphicsContext* graphics);
+    /// Records the pins on the logic gate
+    void RecordPins(RenderList* list);
 
     //void SetPinLocations();
     /**
@@ -148,19 +172,6 @@ protected:
      */
     void CreateOutputPin(std::shared_ptr<PinOutput> pin) { mOutputPins.push_back(pin); }
 
-
-
-     /**
-    * @brief Retrieves the output pins of the item.
-    * @return A vector of shared pointers to the output pins.
-    */
-    std::vector<std::shared_ptr<PinOutput>> GetOutputPins() {return mOutputPins;}
-
-     /**
-    * @brief Retrieves the input pins of the item.
-    * @return A vector of shared pointers to the input pins.
-    */
-    std::vector<std::shared_ptr<PinInput>> GetPinInputs() { return mInputPins; }
 };
 
 #endif //GATE_H
@@ -0,0 +1,103 @@
+/**
+ * @file MappedFile.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <wx/msw/wrapwin.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Constructor, maps the file.
+ *
+ * If the file can't be opened or is empty, IsOk is false.
+ * @param filename Path of the file to map
+ */
+MappedFile::MappedFile(const wxString& filename)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileW(filename.wc_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+    mFile = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        return;
+    }
+    mMapping = mapping;
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data != nullptr)
+    {
+        mData = static_cast<const unsigned char*>(data);
+        mSize = size_t(size.QuadPart);
+    }
+#else
+    int file = open(filename.fn_str(), O_RDONLY);
+    if (file < 0)
+    {
+        return;
+    }
+
+    struct stat status;
+    if (fstat(file, &status) == 0 && status.st_size > 0)
+    {
+        void* data = mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        if (data != MAP_FAILED)
+        {
+            mData = static_cast<const unsigned char*>(data);
+            mSize = size_t(status.st_size);
+        }
+    }
+
+    // The mapping keeps the file open on its own
+    close(file);
+#endif
+}
+
+/**
+ * Destructor, unmaps the file
+ */
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (mData != nullptr)
+    {
+        UnmapViewOfFile(mData);
+    }
+
+    if (mMapping != nullptr)
+    {
+        CloseHandle(mMapping);
+    }
+
+    if (mFile != nullptr)
+    {
+        CloseHandle(mFile);
+    }
+#else
+    if (mData != nullptr)
+    {
+        munmap(const_cast<unsigned char*>(mData), mSize);
+    }
+#endif
+}
@@ -0,0 +1,62 @@
+/**
+ * @file MappedFile.h
+ * @author Conner O'Sullivan
+ *
+ * A file mapped read only into memory
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+/**
+ * A file mapped read only into memory.
+ *
+ * The operating system pages the file in as it is read, so nothing is
+ * copied and the contents can be used in place. The mapping lasts as
+ * long as the object.
+ */
+class MappedFile
+{
+private:
+    const unsigned char* mData = nullptr; ///< The mapped contents, or nullptr if the file couldn't be mapped
+    size_t mSize = 0; ///< Size of the file in bytes
+
+#ifdef _WIN32
+    void* mFile = nullptr; ///< Handle of the open file
+    void* mMapping = nullptr; ///< Handle of the file mapping
+#endif
+
+public:
+    explicit MappedFile(const wxString& filename);
+    ~MappedFile();
+
+    /// Default constructor (disabled)
+    MappedFile() = delete;
+
+    /// Copy constructor (disabled)
+    MappedFile(const MappedFile&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const MappedFile&) = delete;
+
+    /**
+     * Was the file mapped?
+     * @return true if the contents can be read
+     */
+    bool IsOk() const { return mData != nullptr; }
+
+    /**
+     * Get the contents of the file
+     * @return Pointer to the first byte of the file
+     */
+    const unsigned char* GetData() const { return mData; }
+
+    /**
+     * Get the size of the file
+     * @return Size in bytes
+     */
+    size_t GetSize() const { return mSize; }
+};
+
+
+#endif //MAPPEDFILE_H
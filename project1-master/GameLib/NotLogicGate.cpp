@@ -5,8 +5,10 @@
 
 #include "pch.h"
 #include "NotLogicGate.h"
+#include "Game.h"
 #include "PinInput.h"
 #include "PinOutput.h"
+#include "RenderList.h"
 
 
 /**
@@ -32,17 +34,18 @@ NotLogicGate::NotLogicGate(Game* game) : LogicGate(game)
     const wxPoint InputPinLocation((x - w / 1.3), y);
     const wxPoint OutputPinLocation((x + w), y);
 
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation));
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation));
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation));
 }
 
 /**
- * @brief Draws the NOT logic gate.
+ * @brief Records the NOT logic gate.
  *
- * This function creates and draws the shape of the NOT gate on the given
- * gc context using Bezier curves.
+ * This function records the shape of the NOT gate as a triangle
+ * with an inversion bubble at its point.
+ * @param list The render list to record into
  */
-void NotLogicGate::Draw(wxGraphicsContext* gc)
+void NotLogicGate::Record(RenderList* list)
 {
     // The location and size of the gate
     auto x = GetX();
@@ -50,44 +53,27 @@ void NotLogicGate::Draw(wxGraphicsContext* gc)
     auto w = GetWidth();
     auto h = GetHeight();
 
-    // Create a path to draw the gate shape
-    auto path = gc->CreatePath();
-
     // Define the triangle for the NOT gate
     wxPoint2DDouble p1(x - w / 2, y + h / 2); // Bottom left
     wxPoint2DDouble p2(x + w / 2, y); // Middle right (point)
     wxPoint2DDouble p3(x - w / 2, y - h / 2); // Top left
 
+    // Draw pins first
+    RecordPins(list);
+
     // Create the triangle
-    path.MoveToPoint(p1);
-    path.AddLineToPoint(p2);
-    path.AddLineToPoint(p3);
-    path.CloseSubpath();
+    list->MoveTo(p1);
+    list->LineTo(p2);
+    list->LineTo(p3);
+    list->ClosePath();
 
     // Create the inversion bubble
     double bubbleRadius = w * 0.1; // Adjust size as needed
     wxPoint2DDouble bubbleCenter(x + w / 2 + bubbleRadius, y);
-    path.AddCircle(bubbleCenter.m_x, bubbleCenter.m_y, bubbleRadius);
-
-    // Draw pins first
-    DrawPins(gc);
-
-    // Set pen and brush for drawing the gate
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxBLACK_BRUSH);
-
-    // Draw the input pin
-    //gc->StrokeLine(x - w / 2, y, x - (w / 1.25), y);
-    //gc->DrawEllipse(x - (w / 1.25), y - (h / 20), h / 10, h / 10);
-
-    // Draw the output pin
-    //gc->StrokeLine(x + w, y, x + w / 1.5, y);
-    //gc->DrawEllipse(x + w / 1.05, y - (h / 20), h / 10, h / 10);
+    list->Circle(bubbleCenter.m_x, bubbleCenter.m_y, bubbleRadius);
 
     // Draw the NOT gate shape
-    gc->SetBrush(*wxWHITE_BRUSH);
-
-    gc->DrawPath(path);
+    list->FillPath(*wxBLACK, *wxWHITE);
 }
 
 /**
@@ -99,7 +85,7 @@ void NotLogicGate::ComputeOutput()
     // Negate the input pin state
     // set it to its output pin
 
-    auto inputPin = GetPinInputs()[0];
+    auto& inputPin = GetPinInputs()[0];
     State state = inputPin->GetState();
 
     if (state == State::Zero)
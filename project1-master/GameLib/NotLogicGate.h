@@ -43,11 +43,11 @@ public:
     void operator=(const NotLogicGate&) = delete;
 
     /**
-     * @brief Draw the NOT Logic Gate.
+     * @brief Record the NOT Logic Gate.
      *
-     * @param gc Pointer to the wxGraphicsContext used for drawing.
+     * @param list The render list to record into.
      */
-    void Draw(wxGraphicsContext* gc) override;
+    void Record(RenderList* list) override;
 
     /**
      * Compute the output state of the NOT gate
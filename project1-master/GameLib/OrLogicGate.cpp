@@ -6,7 +6,9 @@
 
 #include "pch.h"
 #include "OrLogicGate.h"
+#include "Game.h"
 #include "LogicGate.h"
+#include "RenderList.h"
 
 
 using namespace std;
@@ -36,22 +38,20 @@ OrLogicGate::OrLogicGate(Game* game) : LogicGate(game)
     const wxPoint InputPinLocation2((x - w / 1.5), (y - h / 4.5));
     const wxPoint OutputPinLocation1((x + w / 1.5), (y));
 
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation1));
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation2));
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation1));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation1));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation2));
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation1));
 }
 
 /**
- * @brief Draws the OR logic gate.
+ * @brief Records the OR logic gate.
  *
- * This function creates and draws the shape of the OR gate on the given
- * graphics context using Bezier curves.
+ * This function records the shape of the OR gate as a path made of
+ * Bezier curves.
+ * @param list The render list to record into
  */
-void OrLogicGate::Draw(wxGraphicsContext* gc)
+void OrLogicGate::Record(RenderList* list)
 {
-    // Create a path to draw the OR gate shape
-    auto path = gc->CreatePath();
-
     // Get the location and size
     auto x = GetX();
     auto y = GetY();
@@ -68,38 +68,17 @@ void OrLogicGate::Draw(wxGraphicsContext* gc)
     auto controlPointOffset2 = wxPoint2DDouble(w * 0.75, 0);
     auto controlPointOffset3 = wxPoint2DDouble(w * 0.2, 0);
 
-    // Create the path for the gate
-    path.MoveToPoint(p1);
-    path.AddCurveToPoint(p1 + controlPointOffset1, p1 + controlPointOffset2, p2);
-    path.AddCurveToPoint(p3 + controlPointOffset2, p3 + controlPointOffset1, p3);
-    path.AddCurveToPoint(p3 + controlPointOffset3, p1 + controlPointOffset3, p1);
-    path.CloseSubpath();
-
-
-    DrawPins(gc);
-
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxBLACK_BRUSH);
+    RecordPins(list);
 
-    // Bottom input
-    //gc->StrokeLine((x - w / 3), (y + h / 4.5), (x - w / 1.5), (y + h / 4.5));
-    //gc->DrawEllipse((x - w / 1.5), ((-h / 20) + y + h / 4.5), h / 10, h / 10);
-
-    // Top input
-    //gc->StrokeLine((x - w / 3), (y - h / 4.5), (x - w / 1.5), (y - h / 4.5));
-    //gc->DrawEllipse((x - w / 1.5), ((-h / 20) + y - h / 4.5), h / 10, h / 10);
-
-    // Middle output
-    //gc->StrokeLine((x + w / 3), (y), (x + w / 1.5), (y));
-    //gc->DrawEllipse((x + w / 1.5), ((-h / 20) + y), h / 10, h / 10);
-
-
-    // Set pen and brush
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxWHITE_BRUSH);
+    // Create the path for the gate
+    list->MoveTo(p1);
+    list->CurveTo(p1 + controlPointOffset1, p1 + controlPointOffset2, p2);
+    list->CurveTo(p3 + controlPointOffset2, p3 + controlPointOffset1, p3);
+    list->CurveTo(p3 + controlPointOffset3, p1 + controlPointOffset3, p1);
+    list->ClosePath();
 
     // Draw the path
-    gc->DrawPath(path);
+    list->FillPath(*wxBLACK, *wxWHITE);
 }
 
 /**
@@ -107,7 +86,7 @@ void OrLogicGate::Draw(wxGraphicsContext* gc)
  */
 void OrLogicGate::ComputeOutput()
 {
- for (auto inputPin : GetPinInputs())
+ for (auto& inputPin : GetPinInputs())
  {
   if (inputPin->GetState() == State::Unknown)
   {
@@ -41,11 +41,11 @@ public:
     void operator=(const OrLogicGate&) = delete;
 
     /**
-     * @brief Draw the OR Logic Gate.
+     * @brief Record the OR Logic Gate.
      *
-     * @param gc Pointer to the wxGraphicsContext used for drawing.
+     * @param list The render list to record into.
      */
-    void Draw(wxGraphicsContext* gc) override;
+    void Record(RenderList* list) override;
 
     /**
     * @brief Accept a visitor
@@ -5,6 +5,8 @@
 
 #include "pch.h"
 #include "OutputLogicGate.h"
+#include "Game.h"
+#include "RenderList.h"
 
 using namespace std;
 
@@ -23,18 +25,18 @@ OutputLogicGate::OutputLogicGate(Game* game) : LogicGate(game)
 {
     SetGateSize(OutputGateSize);
     const wxPoint OutputPinLocation((0), (0));
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation));
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation));
 }
 
 /**
- * @brief Draws the Output logic gate.
+ * @brief Records the Output logic gate.
  *
- * This function creates and draws the shape of the Output gate on the given
- * @param gc context using Bezier curves.
+ * The output gate only has its pins to draw.
+ * @param list The render list to record into
  */
-void OutputLogicGate::Draw(wxGraphicsContext* gc)
+void OutputLogicGate::Record(RenderList* list)
 {
-    DrawPins(gc);
+    RecordPins(list);
 }
 
 /**
@@ -42,8 +42,8 @@ public:
     /// Assignment operator (disabled)
     void operator=(const OutputLogicGate&) = delete;
 
-    /// Draw the output logic gate
-    void Draw(wxGraphicsContext* gc) override;
+    /// Record the output logic gate
+    void Record(RenderList* list) override;
 
     /**
     * Accept a visitor
@@ -0,0 +1,49 @@
+/**
+ * @file OutputPinVisitor.h
+ * @author Conner O'Sullivan
+ *
+ * Visitor that collects the output pins of the gates
+ */
+
+#ifndef OUTPUTPINVISITOR_H
+#define OUTPUTPINVISITOR_H
+
+#include "ItemVisitor.h"
+#include "LogicGate.h"
+
+#include <vector>
+
+/**
+ * @class OutputPinVisitor
+ * @brief Collects the output pins of every gate it visits.
+ *
+ * Used by Game::OnDraw to find the pins wires leave from, so every
+ * wire can be recorded after the gates in one pass per state.
+ */
+class OutputPinVisitor : public ItemVisitor
+{
+private:
+    std::vector<PinOutput*>* mPins; ///< Where the pins are collected
+
+public:
+    /**
+     * Constructor
+     * @param pins Where to collect the pins, added after what it already holds
+     */
+    explicit OutputPinVisitor(std::vector<PinOutput*>* pins) : mPins(pins) {}
+
+    /**
+     * Collect the output pins of a gate
+     * @param gate The gate we are visiting
+     */
+    void VisitLogicGate(LogicGate* gate) override
+    {
+        for (auto& pin : gate->GetOutputPins())
+        {
+            mPins->push_back(pin.get());
+        }
+    }
+};
+
+
+#endif //OUTPUTPINVISITOR_H
@@ -5,3 +5,91 @@
 
 #include "pch.h"
 #include "Pin.h"
+#include "LogicGate.h"
+#include "Game.h"
+
+/// Default length of line from the pin
+static const int DefaultLineLength = 20;
+
+/// Diameter to draw the pin in pixels
+static const int PinSize = 10;
+
+/**
+ * Constructor
+ * @param owner The item this pin belongs to
+ * @param location The location relative to the owner
+ */
+Pin::Pin(LogicGate* owner, wxPoint location) :
+    mOwner(owner),
+    mLocation(location),
+    mState(State::Unknown)
+{
+    if (mOwner != nullptr)
+    {
+        mTable = &mOwner->GetGame()->GetPinTable();
+        mHandle = mTable->Add(this);
+        mWireTable = &mOwner->GetGame()->GetWireTable();
+    }
+}
+
+/**
+ * Destructor, the wires to and from this pin go with it
+ * and handles to it no longer find it
+ */
+Pin::~Pin()
+{
+    if (mTable != nullptr)
+    {
+        mWireTable->RemovePin(mHandle);
+        mTable->Remove(mHandle);
+    }
+}
+
+/**
+ * Get the location of the pin
+ * @return Location in pixels
+ */
+wxPoint Pin::GetAbsoluteLocation()
+{
+    double pinX = 0;
+    double pinY = 0;
+    if (!mStatic)
+    {
+        pinX = mOwner->GetX() + mLocation.x;
+        pinY = mOwner->GetY() + mLocation.y;
+    }
+    else
+    {
+        pinX = mLocation.x;
+        pinY = mLocation.y;
+    }
+    return wxPoint(pinX, pinY);
+}
+
+/**
+ * Get the area the pin draws over, the pin circle and
+ * the short line joining it to the gate.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Pin::GetBounds()
+{
+    auto loc = GetAbsoluteLocation();
+    return wxRect2DDouble(loc.x - DefaultLineLength - PinSize / 2, loc.y - PinSize / 2,
+                          DefaultLineLength * 2 + PinSize, PinSize);
+}
+
+/**
+ * Set a state of the Pin
+ *
+ * A change of state changes the colour the pin and its
+ * wires are drawn in, so the owner is repainted.
+ * @param state State enum
+ */
+void Pin::SetState(State state)
+{
+    if (state != mState && mOwner != nullptr)
+    {
+        mOwner->Invalidate();
+    }
+    mState = state;
+}
@@ -10,7 +10,11 @@
 
 #include <wx/graphics.h>
 
+#include "PinTable.h"
+#include "WireTable.h"
+
 class LogicGate;
+class RenderList;
 
 /**
  * Pin states
@@ -34,27 +38,31 @@ protected:
  /// State of the pin
  State mState;
 
+ /// Table other pins find this one through
+ PinTable* mTable = nullptr;
+
+ /// Handle other pins refer to this one with
+ PinHandle mHandle;
+
+ /// Wires between this pin and others
+ WireTable* mWireTable = nullptr;
+
 public:
- /**
-  * Constructor
-  * @param owner The item this pin belongs to
-  * @param location The location relative to the owner
-  */
- Pin(LogicGate* owner, wxPoint location) :
-     mOwner(owner),
-     mLocation(location),
-     mState(State::Unknown) {}
+ Pin(LogicGate* owner, wxPoint location);
 
- /**
-  * Virtual destructor
-  */
- virtual ~Pin() {}
+ virtual ~Pin();
+
+ /// Copy constructor (disabled)
+ Pin(const Pin&) = delete;
+
+ /// Assignment operator (disabled)
+ void operator=(const Pin&) = delete;
 
  /**
-  * Draw the pin
-  * @param gc Graphics context to draw on
+  * Record the commands that draw the pin
+  * @param list The render list to record into
   */
- virtual void Draw(wxGraphicsContext* gc) = 0;
+ virtual void Record(RenderList* list) = 0;
 
  /**
   * Set the pin location in pixels relative to the logic gate
@@ -74,17 +82,23 @@ public:
   */
  LogicGate* GetOwner() { return mOwner; }
 
+ /**
+  * Get the handle other pins refer to this one with
+  * @return Pin handle
+  */
+ PinHandle GetHandle() const { return mHandle; }
+
+ wxPoint GetAbsoluteLocation();
+
+ virtual wxRect2DDouble GetBounds();
+
  /**
   * Get the current state of the Pin
   * @return State enum
   */
  State GetState() { return mState; }
 
- /**
-  * Set a state of the Pin
-  * @param state State enum
-  */
- virtual void SetState(State state) { mState = state; }
+ virtual void SetState(State state);
 
 };
 
@@ -6,6 +6,7 @@
 #include "pch.h"
 #include "PinInput.h"
 #include "LogicGate.h"
+#include "RenderList.h"
 
 /// Default length of line from the pin
 static const int DefaultLineLength = 20;
@@ -35,51 +36,33 @@ PinInput::PinInput(LogicGate* owner, wxPoint location) : Pin(owner, location)
 }
 
 /**
- * Draw the input pin
- * @param gc Display context to draw on
+ * Record the input pin
+ * @param list The render list to record into
  */
-void PinInput::Draw(wxGraphicsContext* gc)
+void PinInput::Record(RenderList* list)
 {
-
-    if (mLine != nullptr)
-    {
-        State state = mLine->GetState();
-        SetState(state);
-    }
-
     auto loc = GetAbsoluteLocation();
 
-    //gc->SetBrush(*wxGREEN_BRUSH);
-    //gc->SetPen(*wxGREEN_PEN);
-    //gc->DrawEllipse(loc.x - PinSize, loc.y - PinSize, PinSize * 2, PinSize * 2);
-
     double lineEndX = loc.x + DefaultLineLength;
     double lineEndY = loc.y;
 
     // Set color based on state
+    wxColour color = ConnectionColorUnknown;
     if (mState == State::One)
     {
-        gc->SetPen(wxPen(ConnectionColorOne, LineWidth));
-        gc->SetBrush(wxBrush(ConnectionColorOne)); // Fill color for the circle
+        color = ConnectionColorOne;
     }
     else if (mState == State::Zero)
     {
-        gc->SetPen(wxPen(ConnectionColorZero, LineWidth));
-        gc->SetBrush(wxBrush(ConnectionColorZero)); // Fill color for the circle
-    }
-    else
-    {
-        gc->SetPen(wxPen(ConnectionColorUnknown, LineWidth));
-        gc->SetBrush(wxBrush(ConnectionColorUnknown)); // Fill color for the circle
+        color = ConnectionColorZero;
     }
 
-    gc->StrokeLine(loc.x, loc.y, lineEndX, lineEndY);
-    gc->SetPen(wxPen(wxColour(0, 0, 0))); // Black outline
+    list->StrokeLine(loc.x, loc.y, lineEndX, lineEndY, color, LineWidth);
 
-    // Draw the pin as a small circle at the end of the line
-    gc->DrawEllipse(loc.x - PinSize / 2,
-                    loc.y - PinSize / 2,
-                    PinSize, PinSize);
+    // Draw the pin as a small circle at the end of the line, with a black outline
+    list->DrawEllipse(loc.x - PinSize / 2,
+                      loc.y - PinSize / 2,
+                      PinSize, PinSize, *wxBLACK, color);
 }
 
 /**
@@ -95,12 +78,13 @@ bool PinInput::Catch(PinOutput* pinOutput, wxPoint lineEnd)
 
     if ((relative.x * relative.x + relative.y * relative.y) < PinSize * PinSize)
     {
-        if (mLine != nullptr)
+        auto line = GetLine();
+        if (line != nullptr)
         {
-            mLine->RemoveCaughtPinInput(this);
+            line->RemoveCaughtPinInput(this);
         }
 
-        mLine = pinOutput;
+        mLine = pinOutput->GetHandle();
         pinOutput->SetCaught(this);
         State state = pinOutput->GetState();
         SetState(state);
@@ -114,27 +98,20 @@ bool PinInput::Catch(PinOutput* pinOutput, wxPoint lineEnd)
 }
 
 /**
- * Get the location of the pin
- * @return Location in pixels
+ * Remove the wire that has caught this pin, if there is one.
+ * With nothing driving it, the pin's state is unknown.
  */
-wxPoint PinInput::GetAbsoluteLocation()
+void PinInput::Disconnect()
 {
-    double pinX = 0;
-    double pinY = 0;
-    if (!mStatic)
+    auto line = GetLine();
+    if (line != nullptr)
     {
-        pinX = mOwner->GetX() + mLocation.x;
-        pinY = mOwner->GetY() + mLocation.y;
+        line->RemoveCaughtPinInput(this);
     }
-    else
-    {
-        pinX = mLocation.x;
-        pinY = mLocation.y;
-    }
-    return wxPoint(pinX, pinY);
-}
-
 
+    mLine = PinHandle();
+    SetState(State::Unknown);
+}
 
 /**
  * @brief Sets the current state of the input pin and triggers output computation.
@@ -144,6 +121,25 @@ wxPoint PinInput::GetAbsoluteLocation()
  */
 void PinInput::SetState(State state)
 {
-    mState = state;
+    Pin::SetState(state);
     mOwner->ComputeOutput();
-}
\ No newline at end of file
+}
+/**
+ * Take the state of the output pin wired to this one.
+ *
+ * The owner computes its output again, as it does for every change of state.
+ * @return true if the state changed
+ */
+bool PinInput::UpdateState()
+{
+    auto line = GetLine();
+    if (line == nullptr)
+    {
+        return false;
+    }
+
+    State state = line->GetState();
+    bool changed = state != mState;
+    SetState(state);
+    return changed;
+}
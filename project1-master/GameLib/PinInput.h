@@ -22,31 +22,33 @@ class PinInput: public Pin
 private:
 
     /// Output pin we are connected to
-    PinOutput* mLine = nullptr;
+    PinHandle mLine;
 
 public:
     PinInput(LogicGate* owner, wxPoint location);
 
-    void Draw(wxGraphicsContext* gc) override;
-
-    wxPoint GetAbsoluteLocation();
+    void Record(RenderList* list) override;
 
     bool Catch(PinOutput* rod, wxPoint lineEnd);
 
+    void Disconnect();
+
     /**
      * Set the line that has caught this pin
      * @param line
      */
-    void SetLine(PinOutput* line) { mLine = line; }
+    void SetLine(PinOutput* line) { mLine = line != nullptr ? line->GetHandle() : PinHandle(); }
 
     /**
     * Get the line variable of the input pin
-    * @return mLine
+    * @return The output pin we are connected to, or null if there is none
     */
-    PinOutput* GetLine() { return mLine; }
+    PinOutput* GetLine() { return mTable != nullptr ? mTable->Get<PinOutput>(mLine) : nullptr; }
 
     /// Sets the current state of the input pin
     void SetState(State state) override;
+
+    bool UpdateState();
 };
 
 
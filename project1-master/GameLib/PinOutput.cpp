@@ -8,6 +8,9 @@
 #include "Item.h"
 #include "LogicGate.h"
 #include "PinInput.h"
+#include "RenderList.h"
+
+#include <algorithm>
 
 /// Default length of line from the pin
 const int DefaultLineLength = 20;
@@ -30,6 +33,9 @@ const wxColour ConnectionColorOne = *wxRED;
 /// Color to use for drawing an unknown state connection wire
 const wxColour ConnectionColorUnknown= wxColour(128, 128, 128);
 
+/// Labels of the control points of a wire
+const wxString ControlPointLabels[] = {L"p1", L"p2", L"p3", L"p4"};
+
 /**
  * Constructor
  * @param owner Item that owns this pin
@@ -46,196 +52,254 @@ PinOutput::PinOutput(LogicGate* owner, wxPoint location) : Pin(owner, location)
  */
 void PinOutput::SetLocation(double x, double y)
 {
+    // Repaint the wire where it was and where it is now
+    mOwner->Invalidate();
     mDragging = true;
-    mCaught = nullptr;
     mLineEnd = wxPoint(int(x), int(y));
+    mOwner->Invalidate();
 }
 
 /**
- * Draw this output pin.
+ * Get the colour to draw wires in for a state
+ * @param state The pin state
+ * @return Wire colour
+ */
+const wxColour& PinOutput::GetConnectionColor(State state)
+{
+    if (state == State::One)
+    {
+        return ConnectionColorOne;
+    }
+    else if (state == State::Zero)
+    {
+        return ConnectionColorZero;
+    }
+    return ConnectionColorUnknown;
+}
+
+/**
+ * Record this output pin and the wire being dragged from it.
  *
- * This is just used in development to see where the
- * pin is supposed to be.
+ * The wires to caught pins are recorded by RecordWires after
+ * every gate, so all the wires of a state are stroked together.
  *
- * @param gc Device context to draw on
+ * @param list The render list to record into
  */
-void PinOutput::Draw(wxGraphicsContext* gc)
+void PinOutput::Record(RenderList* list)
 {
+    wxPoint2DDouble pin = GetPinLocation();
 
-    double pinX = 0;
-    double pinY = 0;
-    if (!mStatic)
+    // Colour of the line based on state
+    const wxColour& color = GetConnectionColor(GetState());
+
+    // Draw line to the pin's location
+    list->StrokeLine(pin.m_x - DefaultLineLength, pin.m_y, pin.m_x, pin.m_y, color, LineWidth);
+
+    // Draw the filled circle at the end of the line
+    list->DrawEllipse(pin.m_x - PinSize / 2,
+                      pin.m_y - PinSize / 2,
+                      PinSize, PinSize, *wxBLACK, color);
+
+    if (mDragging)
     {
-        pinX = mOwner->GetX() + mLocation.x;
-        pinY = mOwner->GetY() + mLocation.y;
+        Wire wire = MakeWire(pin, wxPoint2DDouble(mLineEnd.x, mLineEnd.y));
+
+        // Draw the Bezier curve
+        list->MoveTo(wire.mP1);
+        list->CurveTo(wire.mP2, wire.mP3, wire.mP4);
+        list->StrokePath(color, LineWidth);
+
+        if (mShowControl)
+        {
+            RecordControlPoints(list, wire);
+        }
     }
-    else
+}
+
+/**
+ * Add the wires to the caught pins that cross an area to the path
+ * being built. The caller strokes the path once every pin in the
+ * same state has added its wires.
+ * @param list The render list to record into
+ * @param area Area being drawn in virtual pixels
+ * @return Number of wires added to the path
+ */
+size_t PinOutput::RecordWires(RenderList* list, const wxRect2DDouble& area)
+{
+    UpdateWires(GetPinLocation());
+
+    size_t count = 0;
+    for (auto& wire : mWires)
     {
-        pinX = mLocation.x;
-        pinY = mLocation.y;
+        if (GetWireBounds(wire).Intersects(area))
+        {
+            list->MoveTo(wire.mP1);
+            list->CurveTo(wire.mP2, wire.mP3, wire.mP4);
+            count++;
+        }
     }
 
-    // Update line end coordinates based on pin location
-    double lineEndX = pinX; // Using the calculated pinX
-    double lineEndY = pinY; // Using the calculated pinY
+    return count;
+}
 
-    // Set pen for the line based on state
-    if (GetState() == State::One)
+/**
+ * Record the control points of the wires to the caught pins
+ * that cross an area, if they are being shown
+ * @param list The render list to record into
+ * @param area Area being drawn in virtual pixels
+ */
+void PinOutput::RecordWireControlPoints(RenderList* list, const wxRect2DDouble& area)
+{
+    if (!mShowControl)
     {
-        gc->SetPen(wxPen(ConnectionColorOne, LineWidth));
-        gc->SetBrush(wxBrush(ConnectionColorOne)); // Fill color for the circle
+        return;
     }
-    else if (GetState() == State::Zero)
+
+    UpdateWires(GetPinLocation());
+    for (auto& wire : mWires)
     {
-        gc->SetPen(wxPen(ConnectionColorZero, LineWidth));
-        gc->SetBrush(wxBrush(ConnectionColorZero)); // Fill color for the circle
+        if (GetWireBounds(wire).Intersects(area))
+        {
+            RecordControlPoints(list, wire);
+        }
     }
-    else
+}
+
+/**
+ * Compute the wires to the caught pins again if this pin or
+ * any of them has moved, or a wire was made or removed, since
+ * they were computed.
+ * @param pin Location of this pin
+ */
+void PinOutput::UpdateWires(const wxPoint2DDouble& pin)
+{
+    if (!mWiresDirty && mWiresVersion == mWireTable->GetVersion())
     {
-        gc->SetPen(wxPen(ConnectionColorUnknown, LineWidth));
-        gc->SetBrush(wxBrush(ConnectionColorUnknown)); // Fill color for the circle
+        return;
     }
 
-    // Draw line to the pin's location
-    gc->StrokeLine(pinX - DefaultLineLength, pinY, lineEndX, lineEndY);
+    mWiresDirty = false;
+    mWiresVersion = mWireTable->GetVersion();
 
-    gc->SetPen(wxPen(wxColour(0, 0, 0))); // Black outline
-
-    // Draw the filled circle at the end of the line
-    gc->DrawEllipse(pinX - PinSize / 2,
-                    pinY - PinSize / 2,
-                    PinSize, PinSize);
-
-    //gc->SetBrush(*wxRED_BRUSH);
-    //gc->SetPen(*wxRED_PEN);
-    //gc->DrawEllipse(pinX - PinSize, pinY - PinSize, PinSize * 2, PinSize * 2);
-
-    if (mDragging)
+    mWires.clear();
+    for (auto caught : mWireTable->GetCaught(mHandle))
     {
-        if (GetState() == State::One)
-        {
-            gc->SetPen(wxPen(ConnectionColorOne, LineWidth));
-        }
-        else if (GetState() == State::Zero)
-        {
-            gc->SetPen(wxPen(ConnectionColorZero, LineWidth));
-        }
-        else
+        auto caughtPin = mTable->Get(caught);
+        if (caughtPin != nullptr)
         {
-            gc->SetPen(wxPen(ConnectionColorUnknown, LineWidth));
+            wxPoint inputPin = caughtPin->GetAbsoluteLocation();
+            mWires.push_back(MakeWire(pin, wxPoint2DDouble(inputPin.x, inputPin.y)));
         }
+    }
+}
+
+/**
+ * Compute the Bezier control points for a wire between two points
+ * @param p1 Start of the wire
+ * @param p4 End of the wire
+ * @return The wire geometry
+ */
+PinOutput::Wire PinOutput::MakeWire(const wxPoint2DDouble& p1, const wxPoint2DDouble& p4)
+{
+    double distance = std::hypot(p4.m_x - p1.m_x, p4.m_y - p1.m_y);
+    double offset = std::min(BezierMaxOffset, distance);
 
-        // Calculate control points for the Bezier curve
-        wxPoint2DDouble p1(pinX, pinY);
-        wxPoint2DDouble p4(mLineEnd.x, mLineEnd.y);
+    return {p1, wxPoint2DDouble(p1.m_x + offset, p1.m_y), wxPoint2DDouble(p4.m_x - offset, p4.m_y), p4};
+}
 
-        double distance = std::hypot(p4.m_x - p1.m_x, p4.m_y - p1.m_y);
-        double offset = std::min(BezierMaxOffset, distance);
+/**
+ * Record the control points of a wire and the hull around it
+ * @param list The render list to record into
+ * @param wire The wire to draw the control points of
+ */
+void PinOutput::RecordControlPoints(RenderList* list, const Wire& wire)
+{
+    // Label points with red dots and their names
+    const wxPoint2DDouble* points[] = {&wire.mP1, &wire.mP2, &wire.mP3, &wire.mP4};
+    for (int i = 0; i < 4; i++)
+    {
+        list->DrawEllipse(points[i]->m_x - 2, points[i]->m_y - 2, 4, 4, *wxRED, *wxRED);
+        list->DrawText(ControlPointLabels[i], points[i]->m_x, points[i]->m_y - pinNameOffset,
+                       0, nullptr, 0, *wxRED);
+    }
 
-        wxPoint2DDouble p2(p1.m_x + offset, p1.m_y);
-        wxPoint2DDouble p3(p4.m_x - offset, p4.m_y);
+    // Draw the green rhombus around the Bezier curve area
+    list->MoveTo(wire.mP1);
+    list->LineTo(wire.mP2);
+    list->LineTo(wire.mP4);
+    list->LineTo(wire.mP3);
+    list->ClosePath();
+    list->StrokePath(*wxGREEN, 1);
+}
 
-        // Create the Bezier path
-        wxGraphicsPath path = gc->CreatePath();
-        path.MoveToPoint(p1.m_x, p1.m_y);
-        path.AddCurveToPoint(p2.m_x, p2.m_y, p3.m_x, p3.m_y, p4.m_x, p4.m_y);
+/**
+ * Get the area this pin draws over, including every wire leaving it
+ * and the wire being dragged.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble PinOutput::GetBounds()
+{
+    auto bounds = Pin::GetBounds();
 
-        // Draw the Bezier curve
-        gc->StrokePath(path);
+    wxPoint2DDouble p1 = GetPinLocation();
 
-        if (mShowControl)
-        {
-            // Label points with red dots and their names
-            wxFont font = wxSystemSettings::GetFont(wxSYS_DEFAULT_GUI_FONT);
-            gc->SetFont(font, *wxRED);
-            gc->SetBrush(*wxRED_BRUSH);
-            gc->SetPen(*wxRED_PEN);
-            gc->DrawEllipse(p1.m_x - 2, p1.m_y - 2, 4, 4);
-            gc->DrawEllipse(p2.m_x - 2, p2.m_y - 2, 4, 4);
-            gc->DrawEllipse(p3.m_x - 2, p3.m_y - 2, 4, 4);
-            gc->DrawEllipse(p4.m_x - 2, p4.m_y - 2, 4, 4);
-            gc->DrawText("p1", p1.m_x, p1.m_y - pinNameOffset);
-            gc->DrawText("p2", p2.m_x, p2.m_y - pinNameOffset);
-            gc->DrawText("p3", p3.m_x, p3.m_y - pinNameOffset);
-            gc->DrawText("p4", p4.m_x, p4.m_y - pinNameOffset);
-
-            // Draw the green rhombus around the Bezier curve area
-            gc->SetPen(wxPen(*wxGREEN, 1));
-            wxGraphicsPath rhombus = gc->CreatePath();
-            rhombus.MoveToPoint(p1.m_x, p1.m_y);
-            rhombus.AddLineToPoint(p2.m_x, p2.m_y);
-            rhombus.AddLineToPoint(p4.m_x, p4.m_y);
-            rhombus.AddLineToPoint(p3.m_x, p3.m_y);
-            rhombus.CloseSubpath();
-            gc->StrokePath(rhombus);
-        }
+    if (mDragging)
+    {
+        bounds.Union(GetWireBounds(MakeWire(p1, wxPoint2DDouble(mLineEnd.x, mLineEnd.y))));
     }
 
-    for (auto caughtPin : mCaughts)
+    for (auto caught : mWireTable->GetCaught(mHandle))
     {
+        auto caughtPin = mTable->Get(caught);
         if (caughtPin != nullptr)
         {
-            if (GetState() == State::One)
-            {
-                gc->SetPen(wxPen(ConnectionColorOne, LineWidth));
-            }
-            else if (GetState() == State::Zero)
-            {
-                gc->SetPen(wxPen(ConnectionColorZero, LineWidth));
-            }
-            else
-            {
-                gc->SetPen(wxPen(ConnectionColorUnknown, LineWidth));
-            }
-
             wxPoint inputPin = caughtPin->GetAbsoluteLocation();
-
-            // Calculate control points for the Bezier curve
-            wxPoint2DDouble p1(pinX, pinY);
-            wxPoint2DDouble p4(inputPin.x, inputPin.y);
-
-            double distance = std::hypot(p4.m_x - p1.m_x, p4.m_y - p1.m_y);
-            double offset = std::min(BezierMaxOffset, distance);
-
-            wxPoint2DDouble p2(p1.m_x + offset, p1.m_y);
-            wxPoint2DDouble p3(p4.m_x - offset, p4.m_y);
-
-            // Create the Bezier path
-            wxGraphicsPath path = gc->CreatePath();
-            path.MoveToPoint(p1.m_x, p1.m_y);
-            path.AddCurveToPoint(p2.m_x, p2.m_y, p3.m_x, p3.m_y, p4.m_x, p4.m_y);
-
-            // Draw the Bezier curve
-            gc->StrokePath(path);
-
-            if (mShowControl)
-            {
-                // Label points with red dots and their names
-                wxFont font = wxSystemSettings::GetFont(wxSYS_DEFAULT_GUI_FONT);
-                gc->SetFont(font, *wxRED);
-                gc->SetBrush(*wxRED_BRUSH);
-                gc->SetPen(*wxRED_PEN);
-                gc->DrawEllipse(p1.m_x - 2, p1.m_y - 2, 4, 4);
-                gc->DrawEllipse(p2.m_x - 2, p2.m_y - 2, 4, 4);
-                gc->DrawEllipse(p3.m_x - 2, p3.m_y - 2, 4, 4);
-                gc->DrawEllipse(p4.m_x - 2, p4.m_y - 2, 4, 4);
-                gc->DrawText("p1", p1.m_x, p1.m_y - pinNameOffset);
-                gc->DrawText("p2", p2.m_x, p2.m_y - pinNameOffset);
-                gc->DrawText("p3", p3.m_x, p3.m_y - pinNameOffset);
-                gc->DrawText("p4", p4.m_x, p4.m_y - pinNameOffset);
-
-                // Draw the green rhombus around the Bezier curve area
-                gc->SetPen(wxPen(*wxGREEN, 1));
-                wxGraphicsPath rhombus = gc->CreatePath();
-                rhombus.MoveToPoint(p1.m_x, p1.m_y);
-                rhombus.AddLineToPoint(p2.m_x, p2.m_y);
-                rhombus.AddLineToPoint(p4.m_x, p4.m_y);
-                rhombus.AddLineToPoint(p3.m_x, p3.m_y);
-                rhombus.CloseSubpath();
-                gc->StrokePath(rhombus);
-            }
+            bounds.Union(GetWireBounds(MakeWire(p1, wxPoint2DDouble(inputPin.x, inputPin.y))));
         }
     }
+
+    return bounds;
+}
+
+/**
+ * Get the area a wire draws over.
+ *
+ * A Bezier curve lies inside the hull of its control points,
+ * so the box around them holds the whole wire.
+ * @param wire The wire
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble PinOutput::GetWireBounds(const Wire& wire)
+{
+    double left = std::min(wire.mP1.m_x, wire.mP3.m_x);
+    double right = std::max(wire.mP2.m_x, wire.mP4.m_x);
+    double top = std::min(wire.mP1.m_y, wire.mP4.m_y);
+    double bottom = std::max(wire.mP1.m_y, wire.mP4.m_y);
+
+    // The stroke reaches past the curve, and keeps a straight wire from having no height
+    wxRect2DDouble bounds(left, top, right - left, bottom - top);
+    bounds.Inset(-LineWidth, -LineWidth);
+
+    if (mShowControl)
+    {
+        // Leave room for the control point labels
+        bounds.Inset(-pinNameOffset, -pinNameOffset);
+    }
+
+    return bounds;
+}
+
+/**
+ * Get the location of this pin
+ * @return Location in pixels
+ */
+wxPoint2DDouble PinOutput::GetPinLocation()
+{
+    if (!mStatic)
+    {
+        return wxPoint2DDouble(mOwner->GetX() + mLocation.x, mOwner->GetY() + mLocation.y);
+    }
+    return wxPoint2DDouble(mLocation.x, mLocation.y);
 }
 
 /**
@@ -246,19 +310,8 @@ void PinOutput::Draw(wxGraphicsContext* gc)
  */
 bool PinOutput::HitTest(int x, int y)
 {
-    double pinX = 0;
-    double pinY = 0;
-    if (!mStatic)
-    {
-        pinX = mOwner->GetX() + mLocation.x;
-        pinY = mOwner->GetY() + mLocation.y;
-    }
-    else
-    {
-        pinX = mLocation.x;
-        pinY = mLocation.y;
-    }
-    return (pinX - x) * (pinX - x) + (pinY - y) * (pinY - y) < PinSize * PinSize;
+    wxPoint2DDouble pin = GetPinLocation();
+    return (pin.m_x - x) * (pin.m_x - x) + (pin.m_y - y) * (pin.m_y - y) < PinSize * PinSize;
 }
 
 /**
@@ -276,12 +329,18 @@ void PinOutput::Release()
 {
     if (mDragging)
     {
+        // The wire being dragged is no longer drawn
+        mOwner->Invalidate();
+
         // The mouse has been released. See if there
         // is an input pin we can catch?
         mOwner->GetGame()->TryToCatch(this, mLineEnd);
     }
 
     mDragging = false;
+
+    // Repaint any wire that was caught
+    mOwner->Invalidate();
 }
 
 /**
@@ -294,7 +353,7 @@ void PinOutput::SetCaught(PinInput* caught)
     {
         //if (caught->GetOwner() != mOwner)
         //{
-            mCaughts.push_back(caught);
+            mWireTable->Add(mHandle, caught->GetHandle());
             //if (mOwner != nullptr)
             //{
             //    mOwner->ComputeOutput();
@@ -309,18 +368,24 @@ void PinOutput::SetCaught(PinInput* caught)
  */
 void PinOutput::RemoveCaughtPinInput(PinInput* caught)
 {
-    int i = -1;
-    for (auto element : mCaughts)
+    mWireTable->Remove(mHandle, caught->GetHandle());
+}
+
+/**
+ * Remove every wire leaving this pin
+ */
+void PinOutput::Disconnect()
+{
+    // Copied first, each caught pin removes its wire as it is disconnected
+    auto wires = mWireTable->GetCaught(mHandle);
+    std::vector<PinHandle> caughts(wires.begin(), wires.end());
+
+    for (auto caught : caughts)
     {
-        i += 1;
-        if (element == caught)
+        auto caughtPin = mTable->Get<PinInput>(caught);
+        if (caughtPin != nullptr)
         {
-            break;
+            caughtPin->Disconnect();
         }
     }
-
-    if (i != -1)
-    {
-        mCaughts[i] = nullptr;
-    }
-}
\ No newline at end of file
+}
@@ -26,19 +26,41 @@ private:
     /// Are we dragging the line?
     bool mDragging = false;
 
-    /// Have we caught anything?
-    PinInput* mCaught = nullptr;
-
-    ///Vector that stores the caught PinInputs
-    std::vector<PinInput*> mCaughts;
-
     /// boolean for whether control point should be shown or not
     bool mShowControl = false;
 
+    /**
+     * Geometry of a Bezier wire leaving this pin
+     */
+    struct Wire
+    {
+        wxPoint2DDouble mP1; ///< Start of the wire at this pin
+        wxPoint2DDouble mP2; ///< First control point
+        wxPoint2DDouble mP3; ///< Second control point
+        wxPoint2DDouble mP4; ///< End of the wire
+    };
+
+    /// Wires to the caught pins, in the order they were caught, as of when they were last computed
+    std::vector<Wire> mWires;
+
+    /// Has this pin or a pin it caught moved since mWires was computed?
+    bool mWiresDirty = true;
+
+    /// Version of the wire table when mWires was computed
+    wxUint32 mWiresVersion = 0;
+
+    wxPoint2DDouble GetPinLocation();
+    static Wire MakeWire(const wxPoint2DDouble& p1, const wxPoint2DDouble& p4);
+    wxRect2DDouble GetWireBounds(const Wire& wire);
+    void UpdateWires(const wxPoint2DDouble& pin);
+    void RecordControlPoints(RenderList* list, const Wire& wire);
+
 public:
     PinOutput(LogicGate* owner, wxPoint location);
     void SetLocation(double x, double y) override;
-    void Draw(wxGraphicsContext* gc) override;
+    void Record(RenderList* list) override;
+    size_t RecordWires(RenderList* list, const wxRect2DDouble& area);
+    void RecordWireControlPoints(RenderList* list, const wxRect2DDouble& area);
     bool HitTest(int x, int y);
     void MoveToFront() override;
     void Release() override;
@@ -46,6 +68,24 @@ public:
 
     void RemoveCaughtPinInput(PinInput* caught);
 
+    void Disconnect();
+
+    /**
+     * Get the number of input pins this pin has caught
+     * @return Number of wires leaving this pin
+     */
+    size_t GetNumCaught() { return mWireTable->GetCaught(mHandle).size(); }
+
+    wxRect2DDouble GetBounds() override;
+
+    /**
+     * Have the wires leaving this pin laid out again before they are next
+     * drawn, because this pin or a pin it caught has moved
+     */
+    void SetWiresDirty() { mWiresDirty = true; }
+
+    static const wxColour& GetConnectionColor(State state);
+
     /// Maximum offset of Bezier control points relative to line ends
     static constexpr double BezierMaxOffset = 200;
 
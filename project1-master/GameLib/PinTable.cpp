@@ -0,0 +1,66 @@
+/**
+ * @file PinTable.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "PinTable.h"
+
+/**
+ * Constructor
+ */
+PinTable::PinTable()
+{
+    // Slot 0 is left empty, so that a handle of 0 never refers to a pin
+    mSlots.emplace_back();
+    mSlots[0].mGeneration = 0;
+}
+
+/**
+ * Add a pin to the table
+ * @param pin The pin to add
+ * @return The handle to the pin
+ */
+PinHandle PinTable::Add(Pin* pin)
+{
+    wxUint32 index;
+    if (!mFreeSlots.empty())
+    {
+        index = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    }
+    else
+    {
+        wxASSERT(mSlots.size() <= PinHandle::IndexMask);
+        index = wxUint32(mSlots.size());
+        mSlots.emplace_back();
+    }
+
+    mSlots[index].mPin = pin;
+    return PinHandle(index, mSlots[index].mGeneration);
+}
+
+/**
+ * Remove a pin from the table. Handles to it no longer resolve to a pin.
+ * @param handle The handle to the pin
+ */
+void PinTable::Remove(PinHandle handle)
+{
+    if (Get(handle) == nullptr)
+    {
+        return;
+    }
+
+    auto& slot = mSlots[handle.GetIndex()];
+    slot.mPin = nullptr;
+
+    // The generation wraps within the bits a handle has for it, skipping 0
+    // so a handle to a live pin is never the null handle
+    slot.mGeneration = (slot.mGeneration + 1) & PinHandle::GenerationMask;
+    if (slot.mGeneration == 0)
+    {
+        slot.mGeneration = 1;
+    }
+
+    mFreeSlots.push_back(handle.GetIndex());
+}
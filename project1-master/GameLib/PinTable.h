@@ -0,0 +1,150 @@
+/**
+ * @file PinTable.h
+ * @author Conner O'Sullivan
+ *
+ * Handles that pins use to refer to each other
+ */
+
+#ifndef PINTABLE_H
+#define PINTABLE_H
+
+#include <vector>
+
+class Pin;
+
+/**
+ * A reference to a pin that knows whether the pin still exists.
+ *
+ * A handle is 32 bits, the index of the pin's slot in a PinTable and
+ * the generation of the slot when the pin was added. A handle of 0
+ * refers to no pin.
+ */
+class PinHandle
+{
+private:
+    /// Slot index in the low bits, slot generation in the high bits
+    wxUint32 mValue = 0;
+
+public:
+    /// Number of bits of the handle that hold the slot index
+    static const int IndexBits = 20;
+
+    /// Mask for the slot index
+    static const wxUint32 IndexMask = (1u << IndexBits) - 1;
+
+    /// Mask for the generation, once shifted down
+    static const wxUint32 GenerationMask = (1u << (32 - IndexBits)) - 1;
+
+    /// Constructor, a handle to no pin
+    PinHandle() = default;
+
+    /**
+     * Constructor
+     * @param index Index of the slot
+     * @param generation Generation of the slot
+     */
+    PinHandle(wxUint32 index, wxUint32 generation) :
+        mValue((generation & GenerationMask) << IndexBits | (index & IndexMask)) {}
+
+    /**
+     * Get the index of the slot this handle refers to
+     * @return Slot index
+     */
+    wxUint32 GetIndex() const { return mValue & IndexMask; }
+
+    /**
+     * Get the generation of the slot when this handle was made
+     * @return Slot generation
+     */
+    wxUint32 GetGeneration() const { return mValue >> IndexBits; }
+
+    /**
+     * Does this handle refer to no pin?
+     * @return true if this is a handle to no pin
+     */
+    bool IsNull() const { return mValue == 0; }
+
+    /**
+     * Do two handles refer to the same pin?
+     * @param other The other handle
+     * @return true if they are the same
+     */
+    bool operator==(const PinHandle& other) const { return mValue == other.mValue; }
+
+    /**
+     * Do two handles refer to different pins?
+     * @param other The other handle
+     * @return true if they are different
+     */
+    bool operator!=(const PinHandle& other) const { return mValue != other.mValue; }
+};
+
+/**
+ * Table of every pin in a game, that hands out the handles pins use to
+ * refer to each other.
+ *
+ * Each pin has a slot. When a pin is removed its slot's generation is
+ * advanced, so handles to it resolve to nothing rather than to freed
+ * memory, and the slot is used again for the next pin added. Slots are
+ * kept together in one vector, so resolving a handle is an index and a
+ * compare.
+ */
+class PinTable
+{
+private:
+    /// A pin's place in the table
+    struct Slot
+    {
+        Pin* mPin = nullptr; ///< The pin in this slot, or null if the slot is free
+        wxUint32 mGeneration = 1; ///< Advanced each time the slot is freed
+    };
+
+    std::vector<Slot> mSlots; ///< The slots, index 0 is never used
+    std::vector<wxUint32> mFreeSlots; ///< Indices of slots no pin is using
+
+public:
+    PinTable();
+
+    /// Copy constructor (disabled)
+    PinTable(const PinTable&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const PinTable&) = delete;
+
+    PinHandle Add(Pin* pin);
+    void Remove(PinHandle handle);
+
+    /**
+     * Get the pin a handle refers to
+     * @param handle The handle
+     * @return The pin, or null if it has been removed or the handle is null
+     */
+    Pin* Get(PinHandle handle) const
+    {
+        auto index = handle.GetIndex();
+        if (index >= mSlots.size() || mSlots[index].mGeneration != handle.GetGeneration())
+        {
+            return nullptr;
+        }
+
+        return mSlots[index].mPin;
+    }
+
+    /**
+     * Get the pin a handle refers to as the type it is known to be
+     * @tparam T Type of the pin
+     * @param handle The handle
+     * @return The pin, or null if it has been removed or the handle is null
+     */
+    template<class T>
+    T* Get(PinHandle handle) const { return static_cast<T*>(Get(handle)); }
+
+    /**
+     * Get the number of pins in the table
+     * @return Number of pins
+     */
+    size_t GetCount() const { return mSlots.size() - 1 - mFreeSlots.size(); }
+};
+
+
+#endif //PINTABLE_H
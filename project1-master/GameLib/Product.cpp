@@ -8,6 +8,8 @@
 #include "Game.h"
 #include "Conveyor.h"
 #include "ScoreUpdateVisitor.h"
+#include "ImageCache.h"
+#include "RenderList.h"
 
 
 /// Image directory
@@ -93,6 +95,43 @@ const std::map<Product::Properties, std::wstring> Product::PropertiesToContentIm
 Product::Product(Game* game, Properties shape, Properties color, Properties content, bool kick)
     : Item(game, SmithImage), mShape(shape), mColor(color), mContent(content), mKick(kick)
 {
+    LoadContentBitmap();
+}
+
+/**
+ * Give the product new properties, as when a generator reuses it
+ * for the next product in its stream. The product is no longer kicked.
+ *
+ * @param shape The shape the product takes
+ * @param color The color of the product
+ * @param content The content the product contains
+ * @param kick Indicated whether the product should be kicked
+ */
+void Product::SetProperties(Properties shape, Properties color, Properties content, bool kick)
+{
+    mShape = shape;
+    mColor = color;
+    mContent = content;
+    mKick = kick;
+    mKicked = false;
+    LoadContentBitmap();
+    Invalidate();
+}
+
+/**
+ * Get the bitmap for the product's content from the image cache
+ */
+void Product::LoadContentBitmap()
+{
+    if (mContent != Properties::None)
+    {
+        std::wstring contentImagePath = DirectoryContainingImages + PropertiesToContentImages.at(mContent);
+        mContentBitmap = ImageCache::GetBitmap(contentImagePath);
+    }
+    else
+    {
+        mContentBitmap = nullptr;
+    }
 }
 
 /**
@@ -101,6 +140,18 @@ Product::Product(Game* game, Properties shape, Properties color, Properties cont
  * @param graphics The graphics context to draw on.
  */
 void Product::Draw(wxGraphicsContext* graphics)
+{
+    RenderList list;
+    Record(&list);
+    list.Replay(graphics);
+}
+
+/**
+ * Records the commands that draw a product.
+ *
+ * @param list The render list to record into.
+ */
+void Product::Record(RenderList* list)
 {
     // Set the color based on the product's color property
     wxColour color;
@@ -122,10 +173,6 @@ void Product::Draw(wxGraphicsContext* graphics)
         break;
     }
 
-    // Set the brush and pen for drawing
-    graphics->SetBrush(wxBrush(color));
-    graphics->SetPen(wxPen(color));
-
     // Draw the shape based on the product's shape property
     double size = std::stod(ProductDefaultSize);
     double halfSize = size / 2;
@@ -135,19 +182,15 @@ void Product::Draw(wxGraphicsContext* graphics)
     switch (mShape)
     {
     case Properties::Square:
-        graphics->DrawRectangle(x, y, size, size);
+        list->DrawRectangle(x, y, size, size, color, color);
         break;
 
     case Properties::Circle:
-        graphics->DrawEllipse(x, y, size, size);
+        list->DrawEllipse(x, y, size, size, color, color);
         break;
 
     case Properties::Diamond:
-        graphics->PushState();
-        graphics->Translate(GetX(), GetY());
-        graphics->Rotate(wxDegToRad(45));
-        graphics->DrawRectangle(-halfSize, -halfSize, size, size);
-        graphics->PopState();
+        list->DrawRectangle(x, y, size, size, color, color, wxDegToRad(45));
         break;
 
     default:
@@ -155,16 +198,27 @@ void Product::Draw(wxGraphicsContext* graphics)
     }
 
     // Draw the content if there is any
-    if (mContent != Properties::None)
+    if (mContent != Properties::None && mContentBitmap != nullptr)
     {
         double contentSize = size * ContentScale;
         double contentX = GetX() - contentSize / 2;
         double contentY = GetY() - contentSize / 2;
-        graphics->DrawBitmap(mContentBitmap, contentX, contentY, contentSize, contentSize);
+        list->DrawBitmap(mContentBitmap, contentX, contentY, contentSize, contentSize);
     }
 }
 
 
+/**
+ * Get the area the product draws over, large enough
+ * for any shape including the rotated diamond.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Product::GetBounds()
+{
+    double halfSize = std::stod(ProductDefaultSize) * std::sqrt(2.0) / 2;
+    return wxRect2DDouble(GetX() - halfSize, GetY() - halfSize, halfSize * 2, halfSize * 2);
+}
+
 /**
  * Update the product's position based on the conveyor's speed and elapsed time.
  * @param conveyorSpeed The speed of the conveyor in virtual pixels per second
@@ -253,12 +307,7 @@ void Product::XmlLoad(wxXmlNode* node)
     mContent = NamesToProperties.at(contentStr.ToStdWstring());
     mKick = (kickStr == L"yes");
     placementStr.ToDouble(&mPlacement);
-    if (mContent != Properties::None)
-    {
-        std::wstring contentImagePath = DirectoryContainingImages + L"/" + PropertiesToContentImages.at(mContent);
-        wxImage contentImage(contentImagePath);
-        mContentBitmap = wxBitmap(contentImage);
-    }
+    LoadContentBitmap();
 }
 /**
  * Sets the initial position of a product (used for reset when stop)
@@ -270,6 +319,7 @@ void Product::SetInitialPosition(double x, double y)
 {
     mInitialX = x;
     mInitialY = y;
+    BeginSweep();
 }
 
 /**
@@ -279,4 +329,15 @@ void Product::ResetPosition()
 {
     mKicked = false;
     SetLocation(mInitialX, mInitialY);
-}
\ No newline at end of file
+}
+/**
+ * Record the current location as the start of this tick's travel.
+ *
+ * Beam and sensor detection sweep the product from here to wherever
+ * it ends up after the update, so a large step can't skip a window.
+ */
+void Product::BeginSweep()
+{
+    mSweepStartX = GetX();
+    mSweepStartY = GetY();
+}
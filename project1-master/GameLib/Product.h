@@ -45,6 +45,9 @@ public:
 
     Product(Game* game, Properties shape, Properties color, Properties content, bool kick);
     void Draw(wxGraphicsContext* graphics) override;
+    void Record(RenderList* list) override;
+
+    wxRect2DDouble GetBounds() override;
     void XmlLoad(wxXmlNode* node) override;
 
     /// Default constructor (disabled)
@@ -71,9 +74,12 @@ public:
     void Kicked(double kickspeed);
 
     /**
-     * Sets the current product as the last one on the conveyor
+     * Sets whether the current product is the last one on the conveyor
+     * @param last true if the product is the last one
      */
-    void SetLast() { mLast = true; }
+    void SetLast(bool last = true) { mLast = last; }
+
+    void SetProperties(Properties shape, Properties color, Properties content, bool kick);
 
 
     /**
@@ -110,19 +116,37 @@ public:
 
     void SetInitialPosition(double x, double y);
 
+    void BeginSweep();
+
+    /**
+     * Get the X location of the product at the start of the current tick
+     * @return X location in virtual pixels
+     */
+    double GetSweepStartX() const { return mSweepStartX; }
+
+    /**
+     * Get the Y location of the product at the start of the current tick
+     * @return Y location in virtual pixels
+     */
+    double GetSweepStartY() const { return mSweepStartY; }
+
 private:
     Properties mShape; ///< Shape of the product
     Properties mColor; ///< Color of the product
     Properties mContent; ///< Content of the product
     bool mKick; ///< Bool determining whether the product should be kicked
     double mPlacement{}; ///< Used for getting the true Y value of the product (like an offset)
-    wxBitmap mContentBitmap; ///< Bitmap for the content
+    std::shared_ptr<wxBitmap> mContentBitmap; ///< Bitmap for the content, shared through the ImageCache
     bool mLast = false; ///< Is this product the last one on the conveyor?
     double mLastProductDelay = false; ///< Delay for the last product
     bool mKicked = false; ///< Bool determining if the product's been kicked
     double mKickSpeed; ///< Speed of which the product is kicked
     double mInitialX; ///< Initial x
     double mInitialY; ///< initial y
+    double mSweepStartX = 0; ///< X location at the start of the current tick
+    double mSweepStartY = 0; ///< Y location at the start of the current tick
+
+    void LoadContentBitmap();
 };
 
 
@@ -0,0 +1,237 @@
+/**
+ * @file ProductGenerator.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "ProductGenerator.h"
+#include "Conveyor.h"
+#include "Game.h"
+#include "ProductPool.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * Constructor
+ * @param game Game the products are added to
+ * @param conveyor Conveyor the products ride on
+ */
+ProductGenerator::ProductGenerator(Game* game, Conveyor* conveyor) : mGame(game), mConveyor(conveyor)
+{
+}
+
+/**
+ * Load the generator from its XML node
+ * @param node The <generator> node inside the conveyor
+ */
+void ProductGenerator::XmlLoad(wxXmlNode* node)
+{
+    unsigned long seed = 0;
+    node->GetAttribute(L"seed", L"0").ToULong(&seed);
+    mSeed = unsigned(seed);
+    node->GetAttribute(L"spacing", L"150").ToDouble(&mSpacing);
+    node->GetAttribute(L"placement", L"0").ToDouble(&mPlacement);
+    node->GetAttribute(L"count", L"0").ToInt(&mCount);
+
+    // Products too close together would overlap and be detected as one
+    mSpacing = max(mSpacing, 1.0);
+
+    auto kick = wxSplit(node->GetAttribute(L"kick", L""), ',');
+    for (const auto& name : kick)
+    {
+        auto found = Product::NamesToProperties.find(name.ToStdWstring());
+        if (found != Product::NamesToProperties.end())
+        {
+            mKickProperties.push_back(found->second);
+        }
+    }
+
+    for (auto child = node->GetChildren(); child; child = child->GetNext())
+    {
+        if (child->GetName() != L"property")
+        {
+            continue;
+        }
+
+        auto found = Product::NamesToProperties.find(child->GetAttribute(L"name", L"").ToStdWstring());
+        if (found == Product::NamesToProperties.end())
+        {
+            continue;
+        }
+
+        Choice choice = {found->second, 1};
+        child->GetAttribute(L"weight", L"1").ToDouble(&choice.mWeight);
+
+        switch (Product::PropertiesToTypes.at(choice.mProperty))
+        {
+        case Product::Types::Shape:
+            mShapes.push_back(choice);
+            break;
+
+        case Product::Types::Color:
+            mColors.push_back(choice);
+            break;
+
+        case Product::Types::Content:
+            mContents.push_back(choice);
+            break;
+        }
+    }
+
+    // Types with nothing to choose from use the same defaults as a <product>
+    if (mShapes.empty())
+    {
+        mShapes.push_back({Product::Properties::Square, 1});
+    }
+
+    if (mColors.empty())
+    {
+        mColors.push_back({Product::Properties::Red, 1});
+    }
+
+    if (mContents.empty())
+    {
+        mContents.push_back({Product::Properties::None, 1});
+    }
+}
+
+/**
+ * Choose one property in proportion to the weights
+ * @param choices The properties to choose from
+ * @return The chosen property
+ */
+Product::Properties ProductGenerator::Choose(const std::vector<Choice>& choices)
+{
+    double total = 0;
+    for (const auto& choice : choices)
+    {
+        total += max(choice.mWeight, 0.0);
+    }
+
+    double pick = uniform_real_distribution<double>(0, total)(mRandom);
+    for (const auto& choice : choices)
+    {
+        pick -= max(choice.mWeight, 0.0);
+        if (pick < 0)
+        {
+            return choice.mProperty;
+        }
+    }
+
+    return choices.back().mProperty;
+}
+
+/**
+ * Give a product the properties of the next product in the stream
+ * @param product The product to make
+ */
+void ProductGenerator::Make(Product* product)
+{
+    auto shape = Choose(mShapes);
+    auto color = Choose(mColors);
+    auto content = Choose(mContents);
+    bool kick = any_of(mKickProperties.begin(), mKickProperties.end(), [&](Product::Properties property)
+    {
+        return property == shape || property == color || property == content;
+    });
+
+    product->SetProperties(shape, color, content, kick);
+
+    mMade++;
+    product->SetLast(mCount > 0 && mMade == mCount);
+}
+
+/**
+ * Make the first products and add them to the game.
+ *
+ * Call after the conveyor has been added, so the products are drawn on
+ * top of it. Enough products are made to reach from the end of the
+ * conveyor to above the top of the level.
+ */
+void ProductGenerator::AddProducts()
+{
+    mRandom.seed(mSeed);
+    mMade = 0;
+
+    double firstY = mConveyor->GetY() - mPlacement;
+    double bottom = mConveyor->GetY() + mConveyor->GetHeight() / 2;
+    int needed = int(ceil((bottom - min(firstY, 0.0)) / mSpacing)) + 2;
+    if (mCount > 0)
+    {
+        needed = min(needed, mCount);
+    }
+
+    for (int i = 0; i < needed; i++)
+    {
+        auto product = ProductPool::Make(mGame, Product::Properties::Square, Product::Properties::Red,
+                                         Product::Properties::None, false);
+        Make(product.get());
+
+        double y = firstY - i * mSpacing;
+        product->SetLocation(mConveyor->GetX(), y);
+        product->SetInitialPosition(mConveyor->GetX(), y);
+        mGame->Add(product);
+        mProducts.push_back(product);
+    }
+}
+
+/**
+ * Move products that have run off the end of the conveyor back above
+ * the last product, as the next products in the stream.
+ *
+ * Call after the products have moved.
+ */
+void ProductGenerator::Update()
+{
+    if (mProducts.empty())
+    {
+        return;
+    }
+
+    double bottom = mConveyor->GetY() + mConveyor->GetHeight() / 2;
+    for (auto& product : mProducts)
+    {
+        if (mCount > 0 && mMade >= mCount)
+        {
+            // Every product has been made, the rest just run off the end
+            return;
+        }
+
+        auto bounds = product->GetBounds();
+        if (bounds.m_y <= bottom)
+        {
+            continue;
+        }
+
+        double topY = product->GetY();
+        for (const auto& other : mProducts)
+        {
+            topY = min(topY, other->GetY());
+        }
+
+        Make(product.get());
+        product->SetLocation(mConveyor->GetX(), topY - mSpacing);
+
+        // Moving back to the top isn't travel that the beam or sensor should see
+        product->BeginSweep();
+    }
+}
+
+/**
+ * Start the stream over, as when the conveyor is restarted.
+ *
+ * The products get the same properties they started with. Their
+ * positions are reset along with every other product.
+ */
+void ProductGenerator::Reset()
+{
+    mRandom.seed(mSeed);
+    mMade = 0;
+    for (auto& product : mProducts)
+    {
+        Make(product.get());
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * @file ProductGenerator.h
+ * @author Conner O'Sullivan
+ *
+ * Makes an endless stream of products for a conveyor
+ */
+
+#ifndef PRODUCTGENERATOR_H
+#define PRODUCTGENERATOR_H
+
+#include "Product.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+class Game;
+class Conveyor;
+
+/**
+ * Makes a stream of random products for a conveyor, described by a
+ * <generator> element inside the conveyor in the level XML:
+ *
+ *     <generator seed="335" spacing="150" placement="100" count="0" kick="red,izzo">
+ *         <property name="square" weight="2"/>
+ *         <property name="circle" weight="1"/>
+ *         <property name="red"/>
+ *         <property name="green"/>
+ *         <property name="izzo"/>
+ *         <property name="none" weight="3"/>
+ *     </generator>
+ *
+ * Each product picks one shape, one color and one content, each chosen
+ * from the properties of that type in proportion to their weights. A
+ * product is kicked if it has any of the kick properties. Products are
+ * spacing virtual pixels apart, the first one placement above the center
+ * of the conveyor. Count is how many products to make, or 0 to keep
+ * making them until the level is left.
+ *
+ * Only enough products to cover the conveyor exist at once. A product
+ * that has run off the end of the conveyor is given new properties and
+ * moved back above the top of the level, so memory stays the same no
+ * matter how many products go by.
+ */
+class ProductGenerator
+{
+private:
+    /// A property and how likely it is to be chosen
+    struct Choice
+    {
+        Product::Properties mProperty; ///< The property
+        double mWeight; ///< Weight of the property among the others of its type
+    };
+
+    Game* mGame; ///< Game the products are added to
+    Conveyor* mConveyor; ///< Conveyor the products ride on
+
+    std::mt19937 mRandom; ///< Random numbers that choose the properties
+    unsigned mSeed = 0; ///< Seed the random numbers start from
+
+    double mSpacing = 150; ///< Distance between products in virtual pixels
+    double mPlacement = 0; ///< Distance of the first product above the conveyor center
+    int mCount = 0; ///< Number of products to make, 0 for no limit
+    int mMade = 0; ///< Number of products made so far
+
+    std::vector<Choice> mShapes; ///< Shapes to choose from
+    std::vector<Choice> mColors; ///< Colors to choose from
+    std::vector<Choice> mContents; ///< Contents to choose from
+    std::vector<Product::Properties> mKickProperties; ///< Products with any of these should be kicked
+
+    std::vector<std::shared_ptr<Product>> mProducts; ///< Products currently riding the conveyor
+
+    Product::Properties Choose(const std::vector<Choice>& choices);
+    void Make(Product* product);
+
+public:
+    ProductGenerator(Game* game, Conveyor* conveyor);
+
+    /// Default constructor (disabled)
+    ProductGenerator() = delete;
+
+    /// Copy constructor (disabled)
+    ProductGenerator(const ProductGenerator&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const ProductGenerator&) = delete;
+
+    void XmlLoad(wxXmlNode* node);
+    void AddProducts();
+    void Update();
+    void Reset();
+};
+
+
+#endif //PRODUCTGENERATOR_H
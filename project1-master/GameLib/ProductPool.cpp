@@ -0,0 +1,25 @@
+/**
+ * @file ProductPool.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "ProductPool.h"
+
+/// Number of blocks taken from the heap so far
+size_t ProductPool::mHeapAllocations = 0;
+
+/**
+ * Make a product, reusing the memory of a released one if there is any
+ * @param game The game this product is a member of
+ * @param shape The shape the product takes
+ * @param color The color of the product
+ * @param content The content the product contains
+ * @param kick Indicated whether the product should be kicked
+ * @return The new product
+ */
+std::shared_ptr<Product> ProductPool::Make(Game* game, Product::Properties shape, Product::Properties color,
+                                           Product::Properties content, bool kick)
+{
+    return std::allocate_shared<Product>(ProductPoolAllocator<Product>(), game, shape, color, content, kick);
+}
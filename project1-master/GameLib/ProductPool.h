@@ -0,0 +1,174 @@
+/**
+ * @file ProductPool.h
+ * @author Conner O'Sullivan
+ *
+ * Recycles the memory of products
+ */
+
+#ifndef PRODUCTPOOL_H
+#define PRODUCTPOOL_H
+
+#include "Product.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+/**
+ * Recycles the memory of products.
+ *
+ * A product and its shared pointer bookkeeping live in one block. When
+ * the last reference to a product goes away, for instance when a level
+ * is cleared, the block goes on a free list instead of back to the heap,
+ * and the next product made reuses it. After the first few levels,
+ * loading a level makes its products without allocating anything.
+ * The blocks go back to the heap when the program ends.
+ *
+ * Products are only made and released on the UI thread, so the pool
+ * doesn't lock.
+ */
+class ProductPool
+{
+private:
+    template <class T> friend class ProductPoolAllocator;
+
+    /// Number of blocks taken from the heap so far
+    static size_t mHeapAllocations;
+
+public:
+    /// Constructor (disabled), the pool is only used through its static members
+    ProductPool() = delete;
+
+    static std::shared_ptr<Product> Make(Game* game, Product::Properties shape, Product::Properties color,
+                                         Product::Properties content, bool kick);
+
+    /**
+     * Get the number of blocks taken from the heap so far
+     * @return Number of heap allocations made by the pool
+     */
+    static size_t GetHeapAllocations() { return mHeapAllocations; }
+};
+
+/**
+ * Allocator that keeps freed blocks on a free list for the next
+ * allocation of the same type. Used by ProductPool, through
+ * std::allocate_shared, for the block that holds a product.
+ * @tparam T Type being allocated
+ */
+template <class T>
+class ProductPoolAllocator
+{
+private:
+    /**
+     * The blocks freed so far, ready to be used again. Has room for
+     * every block taken from the heap, so freeing one never allocates,
+     * and returns them all to the heap when the program ends.
+     */
+    struct FreeBlocks
+    {
+        std::vector<T*> mBlocks; ///< Blocks waiting to be used again
+        size_t mCount = 0; ///< Number of single blocks taken from the heap
+
+        /// Destructor, return every block to the heap
+        ~FreeBlocks()
+        {
+            for (auto block : mBlocks)
+            {
+                ::operator delete(block);
+            }
+        }
+    };
+
+    /**
+     * Get the blocks freed so far, ready to be used again
+     * @return The free list for type T
+     */
+    static FreeBlocks& FreeList()
+    {
+        static FreeBlocks freeList;
+        return freeList;
+    }
+
+public:
+    /// Type being allocated
+    typedef T value_type;
+
+    /// Constructor
+    ProductPoolAllocator() = default;
+
+    /**
+     * Converting constructor, used when std::allocate_shared rebinds the allocator
+     * @tparam U Type the other allocator allocates
+     */
+    template <class U>
+    ProductPoolAllocator(const ProductPoolAllocator<U>&)
+    {
+    }
+
+    /**
+     * Allocate memory, from the free list if a block is waiting there
+     * @param n Number of objects to allocate room for
+     * @return The memory
+     */
+    T* allocate(size_t n)
+    {
+        if (n != 1)
+        {
+            ProductPool::mHeapAllocations++;
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        auto& freeList = FreeList();
+        if (!freeList.mBlocks.empty())
+        {
+            T* block = freeList.mBlocks.back();
+            freeList.mBlocks.pop_back();
+            return block;
+        }
+
+        // Make room for this block to come back before handing it out
+        if (freeList.mBlocks.capacity() < freeList.mCount + 1)
+        {
+            freeList.mBlocks.reserve(std::max(freeList.mCount + 1, freeList.mBlocks.capacity() * 2));
+        }
+
+        T* block = static_cast<T*>(::operator new(sizeof(T)));
+        freeList.mCount++;
+        ProductPool::mHeapAllocations++;
+        return block;
+    }
+
+    /**
+     * Free memory, keeping single blocks on the free list
+     * @param block The memory
+     * @param n Number of objects it had room for
+     */
+    void deallocate(T* block, size_t n) noexcept
+    {
+        if (n == 1)
+        {
+            // Never allocates, allocate made room for every block
+            FreeList().mBlocks.push_back(block);
+            return;
+        }
+
+        ::operator delete(block);
+    }
+};
+
+/**
+ * Pool allocators are interchangeable
+ * @return true
+ */
+template <class T, class U>
+bool operator==(const ProductPoolAllocator<T>&, const ProductPoolAllocator<U>&) { return true; }
+
+/**
+ * Pool allocators are interchangeable
+ * @return false
+ */
+template <class T, class U>
+bool operator!=(const ProductPoolAllocator<T>&, const ProductPoolAllocator<U>&) { return false; }
+
+
+#endif //PRODUCTPOOL_H
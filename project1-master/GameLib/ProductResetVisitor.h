@@ -35,6 +35,12 @@ public:
         mReset = conveyor->GetReset();
         mStart = conveyor->GetStarted();
         mConveyor = conveyor;
+
+        // Generated products start over before their positions are reset
+        if (mStart && mReset)
+        {
+            conveyor->ResetProducts();
+        }
     }
 
     /**
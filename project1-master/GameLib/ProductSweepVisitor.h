@@ -0,0 +1,35 @@
+/**
+ * @file ProductSweepVisitor.h
+ * @author Mehrshad Bagherebadian
+ *
+ * Visitor that marks the start of every product's travel for a tick
+ */
+
+#ifndef PRODUCTSWEEPVISITOR_H
+#define PRODUCTSWEEPVISITOR_H
+
+#include "ItemVisitor.h"
+#include "Product.h"
+
+/**
+ * @class ProductSweepVisitor
+ * @brief Records where each product is before the game updates.
+ *
+ * Applied at the start of Game::Update so beam and sensor detection can
+ * test the whole path a product travelled during the tick.
+ */
+class ProductSweepVisitor : public ItemVisitor
+{
+public:
+    /**
+     * Record the product's location as the start of its sweep
+     * @param product The product we are visiting
+     */
+    void VisitProduct(Product* product) override
+    {
+        product->BeginSweep();
+    }
+};
+
+
+#endif //PRODUCTSWEEPVISITOR_H
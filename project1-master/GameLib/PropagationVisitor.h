@@ -0,0 +1,65 @@
+/**
+ * @file PropagationVisitor.h
+ * @author Conner O'Sullivan
+ *
+ * Visitor that carries pin states along the wires between gates
+ */
+
+#ifndef PROPAGATIONVISITOR_H
+#define PROPAGATIONVISITOR_H
+
+#include "ItemVisitor.h"
+#include "LogicGate.h"
+
+/**
+ * @class PropagationVisitor
+ * @brief Gives every gate's input pins the state of the output pin wired to them.
+ *
+ * Applied by Game::Update once the beam and sensor have set their outputs.
+ * One pass moves a signal through gates in the order they are in the
+ * game, so the game applies it again until no input changes.
+ */
+class PropagationVisitor : public ItemVisitor
+{
+private:
+    bool mChanged = false; ///< Did any input change state during this pass?
+    size_t mNumGates = 0; ///< Number of gates visited during this pass
+
+public:
+    /**
+     * Take the states of the wires into the gate's inputs
+     * @param gate The gate we are visiting
+     */
+    void VisitLogicGate(LogicGate* gate) override
+    {
+        mNumGates++;
+        if (gate->UpdateInputs())
+        {
+            mChanged = true;
+        }
+    }
+
+    /**
+     * Did any input change state during the last pass?
+     * @return true if another pass may change more inputs
+     */
+    bool HasChanged() const { return mChanged; }
+
+    /**
+     * Get the number of gates visited during the last pass
+     * @return Number of gates
+     */
+    size_t GetNumGates() const { return mNumGates; }
+
+    /**
+     * Start another pass
+     */
+    void Reset()
+    {
+        mChanged = false;
+        mNumGates = 0;
+    }
+};
+
+
+#endif //PROPAGATIONVISITOR_H
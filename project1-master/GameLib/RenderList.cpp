@@ -0,0 +1,476 @@
+/**
+ * @file RenderList.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "RenderList.h"
+#include "Item.h"
+#include "GraphicsBitmapCache.h"
+#include "GraphicsResourceCache.h"
+
+#include <algorithm>
+#include <cwchar>
+
+/**
+ * Pack a colour into a single RGBA value
+ * @param colour The colour to pack
+ * @return The colour as RGBA
+ */
+static wxUint32 PackColour(const wxColour& colour)
+{
+    return (wxUint32(colour.Red()) << 24) | (wxUint32(colour.Green()) << 16) |
+        (wxUint32(colour.Blue()) << 8) | wxUint32(colour.Alpha());
+}
+
+/**
+ * Unpack a colour packed by PackColour
+ * @param rgba The colour as RGBA
+ * @return The colour
+ */
+static wxColour UnpackColour(wxUint32 rgba)
+{
+    return wxColour((rgba >> 24) & 0xff, (rgba >> 16) & 0xff, (rgba >> 8) & 0xff, rgba & 0xff);
+}
+
+/**
+ * Add a command to the end of the list
+ * @param type What the command draws
+ * @return The new command, with every other member cleared
+ */
+RenderList::Command& RenderList::Add(Type type)
+{
+    mCommands.push_back(Command{});
+    auto& command = mCommands.back();
+    command.mType = type;
+    command.mPenWidth = 1;
+    return command;
+}
+
+/**
+ * Record drawing a bitmap
+ * @param bitmap The bitmap, which has to outlive the replay
+ * @param x Left edge
+ * @param y Top edge
+ * @param width Width to draw the bitmap
+ * @param height Height to draw the bitmap
+ */
+void RenderList::DrawBitmap(const std::shared_ptr<wxBitmap>& bitmap, double x, double y, double width, double height)
+{
+    auto& command = Add(Type::Bitmap);
+    command.mBitmap = &bitmap;
+    command.mX = x;
+    command.mY = y;
+    command.mWidth = width;
+    command.mHeight = height;
+}
+
+/**
+ * Record drawing a filled rectangle
+ * @param x Left edge
+ * @param y Top edge
+ * @param width Width of the rectangle
+ * @param height Height of the rectangle
+ * @param pen Colour of the outline
+ * @param brush Colour of the fill
+ * @param angle Rotation of the rectangle about its center in radians
+ */
+void RenderList::DrawRectangle(double x, double y, double width, double height,
+                               const wxColour& pen, const wxColour& brush, double angle)
+{
+    auto& command = Add(Type::Rectangle);
+    command.mX = x;
+    command.mY = y;
+    command.mWidth = width;
+    command.mHeight = height;
+    command.mAngle = angle;
+    command.mPen = PackColour(pen);
+    command.mBrush = PackColour(brush);
+}
+
+/**
+ * Record drawing a filled ellipse
+ * @param x Left edge
+ * @param y Top edge
+ * @param width Width of the ellipse
+ * @param height Height of the ellipse
+ * @param pen Colour of the outline
+ * @param brush Colour of the fill
+ */
+void RenderList::DrawEllipse(double x, double y, double width, double height,
+                             const wxColour& pen, const wxColour& brush)
+{
+    auto& command = Add(Type::Ellipse);
+    command.mX = x;
+    command.mY = y;
+    command.mWidth = width;
+    command.mHeight = height;
+    command.mPen = PackColour(pen);
+    command.mBrush = PackColour(brush);
+}
+
+/**
+ * Record drawing a line
+ * @param x1 X of the start of the line
+ * @param y1 Y of the start of the line
+ * @param x2 X of the end of the line
+ * @param y2 Y of the end of the line
+ * @param colour Colour of the line
+ * @param width Width of the line
+ */
+void RenderList::StrokeLine(double x1, double y1, double x2, double y2, const wxColour& colour, int width)
+{
+    auto& command = Add(Type::Line);
+    command.mX = x1;
+    command.mY = y1;
+    command.mWidth = x2 - x1;
+    command.mHeight = y2 - y1;
+    command.mPen = PackColour(colour);
+    command.mPenWidth = wxUint16(width);
+}
+
+/**
+ * Record drawing text
+ * @param text The text, which has to outlive the replay
+ * @param x Left edge
+ * @param y Top edge
+ * @param size Size of the font in pixels
+ * @param face Font face name, which has to outlive the replay, or null for the default GUI font
+ * @param flags Font flags
+ * @param colour Colour of the text
+ */
+void RenderList::DrawText(const wxString& text, double x, double y,
+                          double size, const wchar_t* face, int flags, const wxColour& colour)
+{
+    wxUint32 font = FindFont(size, face, flags);
+
+    auto& command = Add(Type::Text);
+    command.mText = &text;
+    command.mX = x;
+    command.mY = y;
+    command.mFirst = font;
+    command.mBrush = PackColour(colour);
+}
+
+/**
+ * Find a font text has been recorded in this frame, adding it if it is new
+ * @param size Size of the font in pixels
+ * @param face Font face name, or null for the default GUI font
+ * @param flags Font flags
+ * @return Index of the font in mFonts
+ */
+wxUint32 RenderList::FindFont(double size, const wchar_t* face, int flags)
+{
+    // There are only ever a few fonts, so a search is quicker than a map
+    for (size_t i = 0; i < mFonts.size(); i++)
+    {
+        const auto& font = mFonts[i];
+        if (font.mSize == size && font.mFlags == flags &&
+            (font.mFace == face || (font.mFace != nullptr && face != nullptr && wcscmp(font.mFace, face) == 0)))
+        {
+            return wxUint32(i);
+        }
+    }
+
+    mFonts.push_back(Font{size, face, flags});
+    return wxUint32(mFonts.size() - 1);
+}
+
+/**
+ * Get the native font for a font on a graphics context
+ * @param graphics The graphics context
+ * @param font The font
+ * @param colour Colour of the text
+ * @return The native font
+ */
+const wxGraphicsFont& RenderList::GetFont(wxGraphicsContext* graphics, const Font& font, const wxColour& colour)
+{
+    if (font.mFace == nullptr)
+    {
+        return GraphicsResourceCache::GetSystemFont(graphics, wxSYS_DEFAULT_GUI_FONT, colour);
+    }
+
+    return GraphicsResourceCache::GetFont(graphics, font.mSize, font.mFace, font.mFlags, colour);
+}
+
+/**
+ * Measure text as it would be drawn by DrawText, so an item
+ * can lay out its text while it records
+ * @param text The text to measure
+ * @param size Size of the font in pixels
+ * @param face Font face name, or null for the default GUI font
+ * @param flags Font flags
+ * @param width Receives the width of the text
+ * @param height Receives the height of the text
+ */
+void RenderList::GetTextExtent(const wxString& text, double size, const wchar_t* face, int flags,
+                               double* width, double* height)
+{
+    if (mMeasuringContext == nullptr)
+    {
+        mMeasuringContext.reset(wxGraphicsRenderer::GetDefaultRenderer()->CreateMeasuringContext());
+    }
+
+    const auto& font = GetFont(mMeasuringContext.get(), Font{size, face, flags}, *wxBLACK);
+    GraphicsResourceCache::GetTextExtent(mMeasuringContext.get(), font, text.ToStdWstring(), width, height);
+}
+
+/**
+ * Record an item that draws itself with Item::Draw when the list is replayed
+ * @param item The item to draw
+ */
+void RenderList::DrawItem(Item* item)
+{
+    auto& command = Add(Type::Item);
+    command.mItem = item;
+}
+
+/**
+ * Add a segment to the path being built
+ * @param type What the segment adds to the path
+ * @param values The points and values of the segment
+ */
+void RenderList::AddSegment(Segment type, std::initializer_list<double> values)
+{
+    mSegments.push_back(PathSegment{type, {}});
+    std::copy(values.begin(), values.end(), mSegments.back().mValues);
+}
+
+/**
+ * Start a new subpath of the path being built at a point
+ * @param point Where the subpath starts
+ */
+void RenderList::MoveTo(const wxPoint2DDouble& point)
+{
+    AddSegment(Segment::Move, {point.m_x, point.m_y});
+}
+
+/**
+ * Add a straight line to the path being built
+ * @param point Where the line ends
+ */
+void RenderList::LineTo(const wxPoint2DDouble& point)
+{
+    AddSegment(Segment::Line, {point.m_x, point.m_y});
+}
+
+/**
+ * Add a cubic Bezier curve to the path being built
+ * @param control1 First control point
+ * @param control2 Second control point
+ * @param point Where the curve ends
+ */
+void RenderList::CurveTo(const wxPoint2DDouble& control1, const wxPoint2DDouble& control2,
+                         const wxPoint2DDouble& point)
+{
+    AddSegment(Segment::Curve, {control1.m_x, control1.m_y, control2.m_x, control2.m_y, point.m_x, point.m_y});
+}
+
+/**
+ * Add an arc of a circle to the path being built
+ * @param x X of the center of the circle
+ * @param y Y of the center of the circle
+ * @param radius Radius of the circle
+ * @param startAngle Angle the arc starts at in radians
+ * @param endAngle Angle the arc ends at in radians
+ * @param clockwise Does the arc go clockwise?
+ */
+void RenderList::Arc(double x, double y, double radius, double startAngle, double endAngle, bool clockwise)
+{
+    AddSegment(Segment::Arc, {x, y, radius, startAngle, endAngle, clockwise ? 1.0 : 0.0});
+}
+
+/**
+ * Add a circle to the path being built as a subpath of its own
+ * @param x X of the center of the circle
+ * @param y Y of the center of the circle
+ * @param radius Radius of the circle
+ */
+void RenderList::Circle(double x, double y, double radius)
+{
+    AddSegment(Segment::Circle, {x, y, radius});
+}
+
+/**
+ * Close the current subpath of the path being built
+ */
+void RenderList::ClosePath()
+{
+    AddSegment(Segment::Close, {});
+}
+
+/**
+ * Add a command that draws the segments added since the last path
+ * @param type Whether the path is stroked or filled
+ * @return The new command
+ */
+RenderList::Command& RenderList::AddPath(Type type)
+{
+    auto& command = Add(type);
+    command.mFirst = wxUint32(mPathStart);
+    command.mCount = wxUint32(mSegments.size() - mPathStart);
+    mPathStart = mSegments.size();
+    return command;
+}
+
+/**
+ * Record stroking the path built since the last path was drawn
+ * @param colour Colour of the path
+ * @param width Width of the path
+ */
+void RenderList::StrokePath(const wxColour& colour, int width)
+{
+    auto& command = AddPath(Type::StrokePath);
+    command.mPen = PackColour(colour);
+    command.mPenWidth = wxUint16(width);
+}
+
+/**
+ * Record filling and outlining the path built since the last path was drawn
+ * @param pen Colour of the outline
+ * @param brush Colour of the fill
+ * @param width Width of the outline
+ */
+void RenderList::FillPath(const wxColour& pen, const wxColour& brush, int width)
+{
+    auto& command = AddPath(Type::FillPath);
+    command.mPen = PackColour(pen);
+    command.mPenWidth = wxUint16(width);
+    command.mBrush = PackColour(brush);
+}
+
+/**
+ * Draw every command in the list, in the order they were recorded
+ * @param graphics The graphics context to draw on
+ */
+void RenderList::Replay(wxGraphicsContext* graphics)
+{
+    // The pen, brush and font the last command left on the context, if we know them
+    const Command* pen = nullptr;
+    const Command* brush = nullptr;
+    const Command* font = nullptr;
+
+    for (const auto& command : mCommands)
+    {
+        switch (command.mType)
+        {
+        case Type::Bitmap:
+            graphics->DrawBitmap(GraphicsBitmapCache::Get(graphics, *command.mBitmap),
+                                 command.mX, command.mY, command.mWidth, command.mHeight);
+            break;
+
+        case Type::Rectangle:
+        case Type::Ellipse:
+        case Type::Line:
+        case Type::StrokePath:
+        case Type::FillPath:
+            if (pen == nullptr || pen->mPen != command.mPen || pen->mPenWidth != command.mPenWidth)
+            {
+                graphics->SetPen(GraphicsResourceCache::GetPen(graphics, UnpackColour(command.mPen), command.mPenWidth));
+                pen = &command;
+            }
+
+            if (command.mType == Type::Line)
+            {
+                graphics->StrokeLine(command.mX, command.mY, command.mX + command.mWidth, command.mY + command.mHeight);
+                break;
+            }
+
+            if (command.mType == Type::StrokePath)
+            {
+                graphics->StrokePath(MakePath(graphics, command));
+                break;
+            }
+
+            if (brush == nullptr || brush->mBrush != command.mBrush)
+            {
+                graphics->SetBrush(GraphicsResourceCache::GetBrush(graphics, UnpackColour(command.mBrush)));
+                brush = &command;
+            }
+
+            if (command.mType == Type::FillPath)
+            {
+                graphics->DrawPath(MakePath(graphics, command));
+            }
+            else if (command.mType == Type::Ellipse)
+            {
+                graphics->DrawEllipse(command.mX, command.mY, command.mWidth, command.mHeight);
+            }
+            else if (command.mAngle != 0)
+            {
+                graphics->PushState();
+                graphics->Translate(command.mX + command.mWidth / 2, command.mY + command.mHeight / 2);
+                graphics->Rotate(command.mAngle);
+                graphics->DrawRectangle(-command.mWidth / 2, -command.mHeight / 2, command.mWidth, command.mHeight);
+                graphics->PopState();
+            }
+            else
+            {
+                graphics->DrawRectangle(command.mX, command.mY, command.mWidth, command.mHeight);
+            }
+            break;
+
+        case Type::Text:
+            if (font == nullptr || font->mFirst != command.mFirst || font->mBrush != command.mBrush)
+            {
+                graphics->SetFont(GetFont(graphics, mFonts[command.mFirst], UnpackColour(command.mBrush)));
+                font = &command;
+            }
+
+            graphics->DrawText(*command.mText, command.mX, command.mY);
+            break;
+
+        case Type::Item:
+            command.mItem->Draw(graphics);
+
+            // The item may have left anything on the context
+            pen = nullptr;
+            brush = nullptr;
+            font = nullptr;
+            break;
+        }
+    }
+}
+
+/**
+ * Make the native path for a path command
+ * @param graphics The graphics context the path is drawn on
+ * @param command The path command
+ * @return The path
+ */
+wxGraphicsPath RenderList::MakePath(wxGraphicsContext* graphics, const Command& command)
+{
+    auto path = graphics->CreatePath();
+    for (wxUint32 i = command.mFirst; i < command.mFirst + command.mCount; i++)
+    {
+        const double* v = mSegments[i].mValues;
+        switch (mSegments[i].mType)
+        {
+        case Segment::Move:
+            path.MoveToPoint(v[0], v[1]);
+            break;
+
+        case Segment::Line:
+            path.AddLineToPoint(v[0], v[1]);
+            break;
+
+        case Segment::Curve:
+            path.AddCurveToPoint(v[0], v[1], v[2], v[3], v[4], v[5]);
+            break;
+
+        case Segment::Arc:
+            path.AddArc(v[0], v[1], v[2], v[3], v[4], v[5] != 0);
+            break;
+
+        case Segment::Circle:
+            path.AddCircle(v[0], v[1], v[2]);
+            break;
+
+        case Segment::Close:
+            path.CloseSubpath();
+            break;
+        }
+    }
+
+    return path;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file RenderList.h
+ * @author Conner O'Sullivan
+ *
+ * List of drawing commands recorded for a frame and replayed on a graphics context
+ */
+
+#ifndef RENDERLIST_H
+#define RENDERLIST_H
+
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+class Item;
+
+/**
+ * List of drawing commands recorded for a frame.
+ *
+ * Items record what they draw as small commands instead of drawing
+ * straight onto a graphics context. The list is then replayed onto a
+ * graphics context in order, only changing the pen, brush or font when
+ * a command needs a different one than the last.
+ *
+ * Paths are built with MoveTo, LineTo and the other segment calls and
+ * then drawn with StrokePath or FillPath. Their segments are kept in a
+ * side buffer so the commands themselves stay small.
+ *
+ * Clearing the list keeps its memory, so a list reused every frame
+ * stops allocating once it has grown to the size of a frame. Bitmaps
+ * and text are recorded by reference and have to outlive the replay.
+ */
+class RenderList
+{
+private:
+    /// Kinds of drawing command
+    enum class Type : wxUint8
+    {
+        Bitmap,
+        Rectangle,
+        Ellipse,
+        Line,
+        StrokePath,
+        FillPath,
+        Text,
+        Item
+    };
+
+    /// One drawing command
+    struct Command
+    {
+        Type mType; ///< What the command draws
+        wxUint16 mPenWidth; ///< Pen width
+        wxUint32 mPen; ///< Pen colour as RGBA
+        wxUint32 mBrush; ///< Brush colour as RGBA, or the text colour
+        wxUint32 mFirst; ///< First segment of a path, or the font of text
+        wxUint32 mCount; ///< Number of segments in a path
+        double mX; ///< Left edge, or the start of a line
+        double mY; ///< Top edge, or the start of a line
+        double mWidth; ///< Width, or how far a line goes in x
+        double mHeight; ///< Height, or how far a line goes in y
+
+        /// What only some kinds of command need
+        union
+        {
+            double mAngle; ///< Rotation of a rectangle about its center in radians
+            const std::shared_ptr<wxBitmap>* mBitmap; ///< Bitmap to draw
+            const wxString* mText; ///< Text to draw
+            Item* mItem; ///< Item that draws itself
+        };
+    };
+
+    /// Kinds of path segment
+    enum class Segment : wxUint8
+    {
+        Move,
+        Line,
+        Curve,
+        Arc,
+        Circle,
+        Close
+    };
+
+    /**
+     * One segment of a path. A move or line has its end point, a curve
+     * its two control points and end point, an arc its center, radius,
+     * start and end angles and direction, and a circle its center and radius.
+     */
+    struct PathSegment
+    {
+        Segment mType; ///< What the segment adds to the path
+        double mValues[6]; ///< The points and values of the segment
+    };
+
+    /// Font text is drawn in
+    struct Font
+    {
+        double mSize; ///< Size of the font in pixels
+        const wchar_t* mFace; ///< Face name, or null for the default GUI font
+        int mFlags; ///< Font flags
+    };
+
+    /// The commands recorded so far this frame
+    std::vector<Command> mCommands;
+
+    /// The segments of every path recorded so far this frame
+    std::vector<PathSegment> mSegments;
+
+    /// First segment of the path being built
+    size_t mPathStart = 0;
+
+    /// The fonts text has been recorded in this frame
+    std::vector<Font> mFonts;
+
+    /// Context text is measured on, made the first time it is needed
+    std::unique_ptr<wxGraphicsContext> mMeasuringContext;
+
+    Command& Add(Type type);
+    void AddSegment(Segment type, std::initializer_list<double> values);
+    Command& AddPath(Type type);
+    wxGraphicsPath MakePath(wxGraphicsContext* graphics, const Command& command);
+    wxUint32 FindFont(double size, const wchar_t* face, int flags);
+    static const wxGraphicsFont& GetFont(wxGraphicsContext* graphics, const Font& font, const wxColour& colour);
+
+public:
+    /// Constructor
+    RenderList() = default;
+
+    /// Copy constructor (disabled)
+    RenderList(const RenderList&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const RenderList&) = delete;
+
+    /**
+     * Remove every command, keeping the memory for the next frame
+     */
+    void Clear()
+    {
+        mCommands.clear();
+        mSegments.clear();
+        mPathStart = 0;
+        mFonts.clear();
+    }
+
+    /**
+     * Get the number of commands recorded
+     * @return Number of commands
+     */
+    size_t GetCount() const { return mCommands.size(); }
+
+    void DrawBitmap(const std::shared_ptr<wxBitmap>& bitmap, double x, double y, double width, double height);
+    void DrawRectangle(double x, double y, double width, double height,
+                       const wxColour& pen, const wxColour& brush, double angle = 0);
+    void DrawEllipse(double x, double y, double width, double height, const wxColour& pen, const wxColour& brush);
+    void StrokeLine(double x1, double y1, double x2, double y2, const wxColour& colour, int width = 1);
+    void DrawText(const wxString& text, double x, double y,
+                  double size, const wchar_t* face, int flags, const wxColour& colour);
+    void DrawItem(Item* item);
+
+    void MoveTo(const wxPoint2DDouble& point);
+    void LineTo(const wxPoint2DDouble& point);
+    void CurveTo(const wxPoint2DDouble& control1, const wxPoint2DDouble& control2, const wxPoint2DDouble& point);
+    void Arc(double x, double y, double radius, double startAngle, double endAngle, bool clockwise);
+    void Circle(double x, double y, double radius);
+    void ClosePath();
+    void StrokePath(const wxColour& colour, int width = 1);
+    void FillPath(const wxColour& pen, const wxColour& brush, int width = 1);
+
+    void GetTextExtent(const wxString& text, double size, const wchar_t* face, int flags,
+                       double* width, double* height);
+
+    void Replay(wxGraphicsContext* graphics);
+};
+
+
+#endif //RENDERLIST_H
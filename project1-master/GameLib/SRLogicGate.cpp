@@ -5,6 +5,8 @@
 
 #include "pch.h"
 #include "SRLogicGate.h"
+#include "Game.h"
+#include "RenderList.h"
 
 
 using namespace std;
@@ -15,6 +17,21 @@ const wxSize SRFlipFlopSize(50, 75);
 /// Gap between the edge of the flip-flop and the labels
 const int SRFlipFlopLabelMargin = 3;
 
+/// Font size for the labels
+const int SRLabelFontSize = 15;
+
+/// Label of the set input
+const wxString SRLabelS = L"S";
+
+/// Label of the reset input
+const wxString SRLabelR = L"R";
+
+/// Label of the Q output
+const wxString SRLabelQ = L"Q";
+
+/// Label of the Q' output
+const wxString SRLabelQBar = L"Q'";
+
 /**
  * Constructor for SR Logic Gate
  * @param game The game this SR Logic Gate belongs to
@@ -34,24 +51,21 @@ SRLogicGate::SRLogicGate(Game* game) : LogicGate(game)
     const wxPoint OutputPinLocation1((x + w / 1.2), (y + h / 2.75));
     const wxPoint OutputPinLocation2((x + w / 1.2), (y - h / 2.75));
 
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation1));
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation2));
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation1));
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation2));
-    auto output = GetOutputPins();
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation1));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation2));
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation1));
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation2));
+    auto& output = GetOutputPins();
     output[1]->SetState(State::Zero); //Q
     output[0]->SetState(State::One); //Q'
 }
 
 /**
- * Draw the SR logic gate
- * @param gc the graphics context we are drawing on
+ * Record the SR logic gate
+ * @param list The render list to record into
  */
-void SRLogicGate::Draw(wxGraphicsContext* gc)
+void SRLogicGate::Record(RenderList* list)
 {
-    // Create path to draw SR Flip Flop
-    auto path = gc->CreatePath();
-
     // Get location and size
     auto x = GetX();
     auto y = GetY();
@@ -64,48 +78,25 @@ void SRLogicGate::Draw(wxGraphicsContext* gc)
     wxPoint2DDouble bottomRight(x + w / 2, y + h / 2);
     wxPoint2DDouble bottomLeft(x - w / 2, y + h / 2);
 
-    // Draw SR Flip Flop
-    path.MoveToPoint(topLeft);
-    path.AddLineToPoint(topRight);
-    path.AddLineToPoint(bottomRight);
-    path.AddLineToPoint(bottomLeft);
-    path.CloseSubpath();
-
+    RecordPins(list);
 
-    DrawPins(gc);
-
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxBLACK_BRUSH);
-
-    // Bottom input
-    //gc->StrokeLine((x - w / 3), (y + h / 2.75), (x - w / 1.2), (y + h / 2.75));
-    //gc->DrawEllipse(((-h / 20) + x - w / 1.2), ((-h / 20) + y + h / 2.75), h / 10, h / 10);
-
-    // Top input
-    //gc->StrokeLine((x - w / 3), (y - h / 2.75), (x - w / 1.2), (y - h / 2.75));
-    //gc->DrawEllipse(((-h / 20) + x - w / 1.2), ((-h / 20) + y - h / 2.75), h / 10, h / 10);
-
-    // Bottom output
-    //gc->StrokeLine((x + w / 3), (y + h / 2.75), (x + w / 1.2), (y + h / 2.75));
-    //gc->DrawEllipse(((-h / 20) + x + w / 1.2), ((-h / 20) + y + h / 2.75), h / 10, h / 10);
-
-    // Top output
-    //gc->StrokeLine((x + w / 3), (y - h / 2.75), (x + w / 1.2), (y - h / 2.75));
-    //gc->DrawEllipse(((-h / 20) + x + w / 1.2), ((-h / 20) + y - h / 2.75), h / 10, h / 10);
-
-
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxWHITE_BRUSH);
-    gc->DrawPath(path);
+    // Draw SR Flip Flop
+    list->MoveTo(topLeft);
+    list->LineTo(topRight);
+    list->LineTo(bottomRight);
+    list->LineTo(bottomLeft);
+    list->ClosePath();
+    list->FillPath(*wxBLACK, *wxWHITE);
 
     // Draw the Labels S, R, Q, Q'
-    auto font = gc->CreateFont(15, L"Arial",
-                               wxFONTFLAG_BOLD, *wxBLACK);
-    gc->SetFont(font);
-    gc->DrawText("S", x - w / 2 + SRFlipFlopLabelMargin, y - h / 2 + SRFlipFlopLabelMargin); //S
-    gc->DrawText("R", x - w / 2 + SRFlipFlopLabelMargin, y + h / 2 - SRFlipFlopLabelMargin - 15); //R
-    gc->DrawText("Q", x + w / 2 - SRFlipFlopLabelMargin - 14, y - h / 2 + SRFlipFlopLabelMargin); //Q
-    gc->DrawText("Q'", x + w / 2 - SRFlipFlopLabelMargin - 14, y + h / 2 - SRFlipFlopLabelMargin - 15); //Q'
+    list->DrawText(SRLabelS, x - w / 2 + SRFlipFlopLabelMargin, y - h / 2 + SRFlipFlopLabelMargin,
+                   SRLabelFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK); //S
+    list->DrawText(SRLabelR, x - w / 2 + SRFlipFlopLabelMargin, y + h / 2 - SRFlipFlopLabelMargin - 15,
+                   SRLabelFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK); //R
+    list->DrawText(SRLabelQ, x + w / 2 - SRFlipFlopLabelMargin - 14, y - h / 2 + SRFlipFlopLabelMargin,
+                   SRLabelFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK); //Q
+    list->DrawText(SRLabelQBar, x + w / 2 - SRFlipFlopLabelMargin - 14, y + h / 2 - SRFlipFlopLabelMargin - 15,
+                   SRLabelFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK); //Q'
 }
 
 /**
@@ -113,14 +104,14 @@ void SRLogicGate::Draw(wxGraphicsContext* gc)
  */
 void SRLogicGate::ComputeOutput()
 {
-    auto inputPins = GetPinInputs();
+    auto& inputPins = GetPinInputs();
 
-    auto sInput = inputPins[1];
-    auto rInput = inputPins[0];
+    auto& sInput = inputPins[1];
+    auto& rInput = inputPins[0];
 
-    auto output = GetOutputPins();
-    auto qOut = output[1];
-    auto qBarOut = output[0];
+    auto& output = GetOutputPins();
+    auto& qOut = output[1];
+    auto& qBarOut = output[0];
 
     auto sState = sInput->GetState();
     auto rState = rInput->GetState();
@@ -30,7 +30,7 @@ public:
     void operator=(const SRLogicGate&) = delete;
 
 
-    void Draw(wxGraphicsContext* gc) override;
+    void Record(RenderList* list) override;
     void ComputeOutput() override;
 
     /**
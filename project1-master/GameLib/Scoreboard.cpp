@@ -5,7 +5,14 @@
 
 #include "pch.h"
 #include "Scoreboard.h"
+#include "Game.h"
+#include "GraphicsBitmapCache.h"
+#include "GraphicsResourceCache.h"
+#include "RenderList.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <sstream>
 
 /// Size of the scoreboard in virtual pixels @return wxSize of Scoreboard
@@ -18,8 +25,29 @@ const int SpacingScoresToInstructions = 40;
 /// The spacing between the instruction lines in virtual pixels.
 const int SpacingInstructionLines = 17;
 
+/// Size of the font the goal is drawn in
+const double GoalFontSize = 15;
+
 using namespace std;
 
+/**
+ * Split the goal of a level into the lines it is drawn as
+ * @param goal The goal, with lines separated by newlines
+ * @return The lines of the goal
+ */
+static vector<wstring> SplitGoal(const wstring& goal)
+{
+    vector<wstring> lines;
+    wstringstream goalStream(goal);
+    wstring line;
+    while (getline(goalStream, line, L'\n'))
+    {
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
 /**
  * @brief Constructor for the Scoreboard.
  *
@@ -37,6 +65,7 @@ Scoreboard::Scoreboard(Game* game, int x, int y, int goodScore, int badScore, in
     : Item(game), mPosition(x, y), mLevel(0),
       mGameScore(gameScore), mGoodScore(goodScore), mBadScore(badScore), mGoal(goal)
 {
+    mGoalLines = SplitGoal(mGoal);
 }
 
 /**
@@ -45,36 +74,135 @@ Scoreboard::Scoreboard(Game* game, int x, int y, int goodScore, int badScore, in
  */
 void Scoreboard::Draw(wxGraphicsContext* graphics)
 {
-    // Draw the scoreboard background
-    graphics->SetBrush(*wxWHITE_BRUSH);
-    graphics->SetPen(*wxBLACK_PEN);
-    graphics->DrawRectangle(mPosition.x, mPosition.y, ScoreboardSize.GetWidth(), ScoreboardSize.GetHeight());
+    RenderList list;
+    Record(&list);
+    list.Replay(graphics);
+}
+
+/**
+ * Record the commands that draw the scores
+ * @param list The render list to record into
+ */
+void Scoreboard::Record(RenderList* list)
+{
+    // Only format the text again when a score has changed
+    if (mLevel != mTextLevel || mGameScore != mTextGameScore)
+    {
+        mTextLevel = mLevel;
+        mTextGameScore = mGameScore;
+        mScoreText = wxString::Format("Level: %d \t\t\t Game: %d", mLevel, mGameScore);
+    }
 
     // Draw the scores
-    auto font = graphics->CreateFont(25, L"Arial", wxFONTFLAG_BOLD, wxColour(24, 69, 59));
-    graphics->SetFont(font);
-    graphics->SetPen(wxPen(wxColour(24, 6, 59)));
+    list->DrawText(mScoreText, mPosition.x + 10, mPosition.y + 10, 25, L"Arial", wxFONTFLAG_BOLD, wxColour(24, 69, 59));
+}
 
-    wxString scoreText = wxString::Format("Level: %d \t\t\t Game: %d", mLevel, mGameScore);
-    graphics->DrawText(scoreText, mPosition.x + 10, mPosition.y + 10);
+/**
+ * Draw the scoreboard background and the goal of the level,
+ * which don't change while the level is played
+ * @param graphics The graphics context to draw on
+ */
+void Scoreboard::DrawStatic(wxGraphicsContext* graphics)
+{
+    // Draw the scoreboard background
+    graphics->SetBrush(GraphicsResourceCache::GetBrush(graphics, *wxWHITE));
+    graphics->SetPen(GraphicsResourceCache::GetPen(graphics, *wxBLACK));
+    graphics->DrawRectangle(mPosition.x, mPosition.y, ScoreboardSize.GetWidth(), ScoreboardSize.GetHeight());
 
-    // Draw the goal of the level
-    font = graphics->CreateFont(15, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
-    graphics->SetFont(font);
+    if (mGoalLines.empty())
+    {
+        return;
+    }
+
+    // Draw the goal of the level from a bitmap, laying it out again only when the goal or scale changes
+    double scale = GetGame()->GetScale();
+    if (mGoalBitmap == nullptr || scale != mGoalBitmapScale || mGoal != mGoalBitmapText)
+    {
+        RenderGoal(graphics, scale);
+    }
 
     // This is the y position of the first instruction line
-    int instructionY = mPosition.y + 10 + SpacingScoresToInstructions;
-    // Create a stream to read the goal
-    std::wstringstream goalStream(mGoal);
-    // Read the goal line by line and draw it
-    std::wstring line;
-    while (std::getline(goalStream, line, L'\n'))
+    double instructionX = mPosition.x + 10;
+    double instructionY = mPosition.y + 10 + SpacingScoresToInstructions;
+    graphics->DrawBitmap(GraphicsBitmapCache::Get(graphics, mGoalBitmap), instructionX + mGoalRect.m_x,
+                         instructionY + mGoalRect.m_y, mGoalRect.m_width, mGoalRect.m_height);
+}
+
+/**
+ * Pre-render the goal of the level into a bitmap
+ * at the size it takes in device pixels.
+ * @param graphics Graphics context the goal is measured on
+ * @param scale Device pixels per virtual pixel
+ */
+void Scoreboard::RenderGoal(wxGraphicsContext* graphics, double scale)
+{
+    mGoalBitmapText = mGoal;
+    mGoalBitmapScale = scale;
+
+    // Size of the lines as they are drawn, with a pixel to spare for antialiasing
+    const auto& font = GraphicsResourceCache::GetFont(graphics, GoalFontSize, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
+    double goalWidth = 0;
+    double goalHeight = 0;
+    for (size_t i = 0; i < mGoalLines.size(); i++)
     {
-        graphics->DrawText(line, mPosition.x + 10, instructionY);
-        instructionY += SpacingInstructionLines;
+        double width, height;
+        GraphicsResourceCache::GetTextExtent(graphics, font, mGoalLines[i], &width, &height);
+        goalWidth = std::max(goalWidth, width);
+        goalHeight = std::max(goalHeight, i * SpacingInstructionLines + height);
+    }
+
+    mGoalRect = wxRect2DDouble(0, 0, goalWidth, goalHeight);
+    mGoalRect.Inset(-1 / scale, -1 / scale);
+
+    int goalPixelWidth = std::max(1, int(std::ceil(mGoalRect.m_width * scale)));
+    int goalPixelHeight = std::max(1, int(std::ceil(mGoalRect.m_height * scale)));
+
+    wxImage goalImage(goalPixelWidth, goalPixelHeight, true);
+    goalImage.InitAlpha();
+    memset(goalImage.GetAlpha(), 0, (size_t)goalPixelWidth * goalPixelHeight);
+
+    {
+        // The image is updated when the context is destroyed
+        auto goalGraphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(goalImage));
+        goalGraphics->Scale(goalPixelWidth / mGoalRect.m_width, goalPixelHeight / mGoalRect.m_height);
+        goalGraphics->Translate(-mGoalRect.m_x, -mGoalRect.m_y);
+        goalGraphics->SetFont(GraphicsResourceCache::GetFont(goalGraphics.get(), GoalFontSize, L"Arial",
+                                                             wxFONTFLAG_BOLD, *wxBLACK));
+
+        double lineY = 0;
+        for (const auto& line : mGoalLines)
+        {
+            goalGraphics->DrawText(line, 0, lineY);
+            lineY += SpacingInstructionLines;
+        }
+    }
+
+    mGoalBitmap = std::make_shared<wxBitmap>(goalImage);
+}
+
+/**
+ * Repaint the scoreboard when a score has changed since the last update
+ * @param elapsed The time since the last update
+ */
+void Scoreboard::Update(double elapsed)
+{
+    if (mLevel != mShownLevel || mGameScore != mShownGameScore)
+    {
+        mShownLevel = mLevel;
+        mShownGameScore = mGameScore;
+        Invalidate();
     }
 }
 
+/**
+ * Get the area the scoreboard draws over
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Scoreboard::GetBounds()
+{
+    return wxRect2DDouble(mPosition.x, mPosition.y, ScoreboardSize.GetWidth(), ScoreboardSize.GetHeight());
+}
+
 /**
  * @brief Updates the level score based on Sparty's action and the item's desired state.
  *
@@ -130,4 +258,6 @@ void Scoreboard::XmlLoad(wxXmlNode* node)
             mGoal += L"\n";
         }
     }
+
+    mGoalLines = SplitGoal(mGoal);
 }
@@ -22,6 +22,20 @@ private:
     int mGoodScore = 10; ///< The score for good kicks
     int mBadScore = 0; ///< The score for bad kicks
     std::wstring mGoal; ///< The goal for the level
+    int mShownLevel = 0; ///< The level score as of the last update
+    int mShownGameScore = 0; ///< The game score as of the last update
+
+    wxString mScoreText; ///< Formatted scores, rebuilt only when a score changes
+    int mTextLevel = -1; ///< The level score mScoreText was formatted for
+    int mTextGameScore = -1; ///< The game score mScoreText was formatted for
+    std::vector<std::wstring> mGoalLines; ///< The goal split into lines when loaded
+
+    std::shared_ptr<wxBitmap> mGoalBitmap; ///< The goal pre-rendered at mGoalBitmapScale
+    wxRect2DDouble mGoalRect; ///< Where mGoalBitmap goes relative to the first goal line, in virtual pixels
+    std::wstring mGoalBitmapText; ///< The goal mGoalBitmap was rendered from
+    double mGoalBitmapScale = 0; ///< Scale mGoalBitmap was rendered at
+
+    void RenderGoal(wxGraphicsContext* graphics, double scale);
 
 public:
     Scoreboard(Game* game, int x, int y, int goodScore, int badScore, int gameScore, std::wstring& goal);
@@ -35,7 +49,11 @@ public:
 
 
     void Draw(wxGraphicsContext* graphics) override;
+    void Record(RenderList* list) override;
+    void DrawStatic(wxGraphicsContext* graphics) override;
     void XmlLoad(wxXmlNode* node) override;
+    void Update(double elapsed) override;
+    wxRect2DDouble GetBounds() override;
 
     void UpdateLevelScore(bool spartyKicked, bool itemWantsBeingKicked);
 
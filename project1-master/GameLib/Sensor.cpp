@@ -8,6 +8,9 @@
 #include "OutputLogicGate.h"
 #include "Product.h"
 #include "SensorDetectionVisitor.h"
+#include "SweptInterval.h"
+#include "ImageCache.h"
+#include "GraphicsBitmapCache.h"
 
 
 /// Default length of line from the pin
@@ -47,18 +50,6 @@ const wxColour MSUGreen(24, 69, 59);
 /// Color to use for "blue" @return color of blue products
 const wxColor UofMBlue(0, 39, 76);
 
-/// Image for basketball
-const std::wstring BasketballImage = DirectoryContainingImages + L"basketball.png";
-
-/// Image for football
-const std::wstring FootballImage = DirectoryContainingImages + L"football.png";
-
-/// Image for Izzo
-const std::wstring IzzoImage = DirectoryContainingImages + L"izzo.png";
-
-/// Image for Smith
-const std::wstring SmithImage = DirectoryContainingImages + L"smith.png";
-
 /**
  * Constructor for the sensor
  *
@@ -66,24 +57,57 @@ const std::wstring SmithImage = DirectoryContainingImages + L"smith.png";
  * @param outputs The output panels supported by the sensor
  */
 Sensor::Sensor(Game* game, std::vector<std::wstring> outputs)
-    : Item(game, SensorCameraImage), mOutputs(outputs)
+    : Item(game, SensorCameraImage)
 {
-    wxImage cameraImage(SensorCameraImage);
-    wxImage cableImage(SensorCableImage);
+    for (const auto& output : outputs)
+    {
+        auto found = Product::NamesToProperties.find(output);
+        if (found != Product::NamesToProperties.end())
+        {
+            mOutputs.push_back(found->second);
+        }
+    }
 
-    mCameraBitmap = wxBitmap(cameraImage);
-    mCableBitmap = wxBitmap(cableImage);
+    mCameraBitmap = ImageCache::GetBitmap(SensorCameraImage);
+    mCableBitmap = ImageCache::GetBitmap(SensorCableImage);
 
     mImagesLoaded = true;
 }
 
 /**
- * Draws the sensor on the given graphics context.
- * NOTE: OUTPUT PANELS STILL NEED TO BE IMPLEMENTED
+ * Set the location of the sensor, moving its output gates with it
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ */
+void Sensor::SetLocation(double x, double y)
+{
+    Item::SetLocation(x, y);
+    PlaceOutputGates();
+}
+
+/**
+ * Place the output gates next to their panels
+ */
+void Sensor::PlaceOutputGates()
+{
+    double panelX = GetX() + mCableBitmap->GetWidth() / 2;
+    double panelY = GetY() + PanelOffsetY;
+    for (auto& gate : mOutputGates)
+    {
+        wxPoint pinLocation(panelX + PropertySize.GetWidth(), panelY + PropertySize.GetHeight() / 2);
+        gate->SetLocation(pinLocation.x + DefaultLineLength, pinLocation.y);
+
+        // Move to the next panel position
+        panelY += PropertySize.GetHeight();
+    }
+}
+
+/**
+ * Draws the sensor camera, cable and output panels on the given graphics context.
  *
  * @param graphics The graphics context to draw on.
  */
-void Sensor::Draw(wxGraphicsContext* graphics)
+void Sensor::DrawStatic(wxGraphicsContext* graphics)
 {
     if (!mImagesLoaded)
     {
@@ -96,39 +120,39 @@ void Sensor::Draw(wxGraphicsContext* graphics)
     double y = GetY();
 
     // Calculate positions
-    int cameraX = x - mCameraBitmap.GetWidth() / 2;
-    int cameraY = y - mCameraBitmap.GetHeight() / 2;
-    int cableX = x - mCableBitmap.GetWidth() / 2;
+    int cameraX = x - mCameraBitmap->GetWidth() / 2;
+    int cameraY = y - mCameraBitmap->GetHeight() / 2;
+    int cableX = x - mCableBitmap->GetWidth() / 2;
     int cableY = cameraY;
 
     // Draw the camera and cable
-    graphics->DrawBitmap(mCableBitmap, cableX, cableY, mCableBitmap.GetWidth(), mCableBitmap.GetHeight());
-    graphics->DrawBitmap(mCameraBitmap, cameraX, cameraY, mCameraBitmap.GetWidth(), mCameraBitmap.GetHeight());
+    graphics->DrawBitmap(GraphicsBitmapCache::Get(graphics, mCableBitmap), cableX, cableY, mCableBitmap->GetWidth(), mCableBitmap->GetHeight());
+    graphics->DrawBitmap(GraphicsBitmapCache::Get(graphics, mCameraBitmap), cameraX, cameraY, mCameraBitmap->GetWidth(), mCameraBitmap->GetHeight());
 
     // Define the starting position for the panels
-    double panelX = x + mCableBitmap.GetWidth() / 2;
+    double panelX = x + mCableBitmap->GetWidth() / 2;
     double panelY = y + PanelOffsetY;
 
     // Draw the panels
     for (size_t i = 0; i < mOutputs.size(); ++i)
     {
-        const auto& output = mOutputs[i];
+        auto output = mOutputs[i];
 
-        // Set the panel color based on the output name
+        // Set the panel color based on the output property
         wxColour panelColor;
-        if (output == L"red")
+        if (output == Product::Properties::Red)
         {
             panelColor = OhioStateRed;
         }
-        else if (output == L"green")
+        else if (output == Product::Properties::Green)
         {
             panelColor = MSUGreen;
         }
-        else if (output == L"blue")
+        else if (output == Product::Properties::Blue)
         {
             panelColor = UofMBlue;
         }
-        else if (output == L"white")
+        else if (output == Product::Properties::White)
         {
             panelColor = *wxWHITE;
         }
@@ -142,15 +166,15 @@ void Sensor::Draw(wxGraphicsContext* graphics)
         graphics->SetPen(*wxBLACK_PEN);
         graphics->DrawRectangle(panelX, panelY, PropertySize.GetWidth(), PropertySize.GetHeight());
 
-        // Draw the panel content based on the output name
+        // Draw the panel content based on the output property
         if (mPanelImages.find(output) != mPanelImages.end())
         {
-            wxBitmap contentBitmap = mPanelImages[output];
+            const auto& contentBitmap = mPanelImages[output];
             double contentX = panelX + (PropertySize.GetWidth() - PropertyShapeSize) / 2;
             double contentY = panelY + (PropertySize.GetHeight() - PropertyShapeSize) / 2;
-            graphics->DrawBitmap(contentBitmap, contentX, contentY, PropertyShapeSize, PropertyShapeSize);
+            graphics->DrawBitmap(GraphicsBitmapCache::Get(graphics, contentBitmap), contentX, contentY, PropertyShapeSize, PropertyShapeSize);
         }
-        else if (output == L"circle")
+        else if (output == Product::Properties::Circle)
         {
             double shapeX = panelX + (PropertySize.GetWidth() - PropertyShapeSize) / 2;
             double shapeY = panelY + (PropertySize.GetHeight() - PropertyShapeSize) / 2;
@@ -158,7 +182,7 @@ void Sensor::Draw(wxGraphicsContext* graphics)
             graphics->SetPen(*wxBLACK_PEN);
             graphics->DrawEllipse(shapeX, shapeY, PropertyShapeSize, PropertyShapeSize);
         }
-        else if (output == L"square")
+        else if (output == Product::Properties::Square)
         {
             double shapeX = panelX + (PropertySize.GetWidth() - PropertyShapeSize) / 2;
             double shapeY = panelY + (PropertySize.GetHeight() - PropertyShapeSize) / 2;
@@ -166,7 +190,7 @@ void Sensor::Draw(wxGraphicsContext* graphics)
             graphics->SetPen(*wxBLACK_PEN);
             graphics->DrawRectangle(shapeX, shapeY, PropertyShapeSize, PropertyShapeSize);
         }
-        else if (output == L"diamond")
+        else if (output == Product::Properties::Diamond)
         {
             double shapeX = panelX + (PropertySize.GetWidth() - PropertyShapeSize) / 2;
             double shapeY = panelY + (PropertySize.GetHeight() - PropertyShapeSize) / 2;
@@ -179,11 +203,6 @@ void Sensor::Draw(wxGraphicsContext* graphics)
                                     PropertyShapeSize);
             graphics->PopState();
         }
-        if (i < mOutputGates.size())
-        {
-            wxPoint pinLocation(panelX + PropertySize.GetWidth(), panelY + PropertySize.GetHeight() / 2);
-            mOutputGates[i]->SetLocation(pinLocation.x + DefaultLineLength, pinLocation.y);
-        }
         // Move to the next panel position
         panelY += PropertySize.GetHeight();
     }
@@ -191,10 +210,10 @@ void Sensor::Draw(wxGraphicsContext* graphics)
     // Draw lines indicating sensor range
     /*
     graphics->SetPen(*wxRED_PEN);
-    graphics->StrokeLine(GetX() - mCameraBitmap.GetWidth() / 2, GetY() + SensorRange[0],
-                         GetX() + mCameraBitmap.GetWidth() / 2, GetY() + SensorRange[0]);
-    graphics->StrokeLine(GetX() - mCameraBitmap.GetWidth() / 2, GetY() + SensorRange[1],
-                         GetX() + mCameraBitmap.GetWidth() / 2, GetY() + SensorRange[1]);
+    graphics->StrokeLine(GetX() - mCameraBitmap->GetWidth() / 2, GetY() + SensorRange[0],
+                         GetX() + mCameraBitmap->GetWidth() / 2, GetY() + SensorRange[0]);
+    graphics->StrokeLine(GetX() - mCameraBitmap->GetWidth() / 2, GetY() + SensorRange[1],
+                         GetX() + mCameraBitmap->GetWidth() / 2, GetY() + SensorRange[1]);
     */
 }
 
@@ -222,18 +241,17 @@ void Sensor::Update()
 
 
 /**
- * @brief Checks if a product is within the sensor's detection range.
+ * @brief Checks if a product was within the sensor's detection range during this tick.
  *
- * Determines whether the specified product is within the horizontal and vertical bounds
- * of the sensor's detection range, based on the sensor's position and detection area.
+ * Sweeps the product's bounds from where it started the tick to where it is now
+ * and checks them against the horizontal and vertical bounds of the sensor's
+ * detection area, so a product moving fast enough to step over the range
+ * between updates is still seen.
  * @param product The product to check for range.
- * @return `true` if the product is within the sensor's range, `false` otherwise.
+ * @return `true` if the product was within the sensor's range at any time this tick, `false` otherwise.
  */
 bool Sensor::IsProductInRange(const Product& product)
 {
-    // Get product's position
-    double productX = product.GetX();
-    double productY = product.GetY();
     double productHeight = product.GetHeight();
 
     // Get sensor's position
@@ -241,18 +259,22 @@ bool Sensor::IsProductInRange(const Product& product)
     double sensorY = GetY();
 
     // Calculate the horizontal bounds of the sensor's detection range (based on mCameraBitmap width)
-    double sensorLeftX = sensorX - mCameraBitmap.GetWidth() / 2;
-    double sensorRightX = sensorX + mCameraBitmap.GetWidth() / 2;
-
-    // Calculate the vertical bounds of the product
-    double productTopY = productY - productHeight / 2;
-    double productBottomY = productY + productHeight / 2;
-
-    // Check if the product's position is within both the horizontal and vertical range of the sensor
-    bool withinXRange = (productX >= sensorLeftX && productX <= sensorRightX);
-    bool withinYRange = (productBottomY >= sensorY + SensorRange[0] && productTopY <= sensorY + SensorRange[1]);
-
-    return withinXRange && withinYRange;
+    double sensorLeftX = sensorX - mCameraBitmap->GetWidth() / 2;
+    double sensorRightX = sensorX + mCameraBitmap->GetWidth() / 2;
+
+    // The product's center has to be within the horizontal range...
+    SweptInterval interval = SweptInterval::Sweep(product.GetSweepStartX(), product.GetSweepStartX(),
+                                                  product.GetX(), product.GetX(),
+                                                  sensorLeftX, sensorRightX);
+
+    // ...at the same time as its vertical bounds overlap the vertical range
+    double startY = product.GetSweepStartY();
+    interval.Intersect(SweptInterval::Sweep(startY - productHeight / 2, startY + productHeight / 2,
+                                            product.GetY() - productHeight / 2,
+                                            product.GetY() + productHeight / 2,
+                                            sensorY + SensorRange[0], sensorY + SensorRange[1]));
+
+    return !interval.IsEmpty();
 }
 
 
@@ -260,9 +282,9 @@ bool Sensor::IsProductInRange(const Product& product)
  * @brief Activates the output pin associated with a specified property.
  *
  * Finds the output pin corresponding to the provided property and sets its state to active (`State::One`).
- * @param property The property name as a wide string that determines which output pin to activate.
+ * @param property The property that determines which output pin to activate.
  */
-void Sensor::ActivateOutputPin(const std::wstring& property)
+void Sensor::ActivateOutputPin(Product::Properties property)
 {
     // Find and activate the output gate associated with the property
     auto it = std::find(mOutputs.begin(), mOutputs.end(), property);
@@ -307,40 +329,47 @@ void Sensor::XmlLoad(wxXmlNode* node)
     wxXmlNode* child = node->GetChildren();
     while (child)
     {
-        std::wstring outputName = child->GetName().ToStdWstring();
-        mOutputs.push_back(outputName);
-
-        // Load the image for the panel if it matches specific names
-        if (outputName == L"izzo" || outputName == L"smith" || outputName == L"basketball" || outputName == L"football")
-        {
-            std::wstring contentImagePath;
-            if (outputName == L"izzo")
-            {
-                contentImagePath = IzzoImage;
-            }
-            else if (outputName == L"smith")
-            {
-                contentImagePath = SmithImage;
-            }
-            else if (outputName == L"basketball")
-            {
-                contentImagePath = BasketballImage;
-            }
-            else if (outputName == L"football")
-            {
-                contentImagePath = FootballImage;
-            }
-
-            wxImage contentImage(contentImagePath);
-            mPanelImages[outputName] = wxBitmap(contentImage);
-        }
-        // Create a new OutputLogicGate for the panel
-        auto outputGate = std::make_shared<OutputLogicGate>(GetGame());
-        mOutputGates.push_back(outputGate);
-        outputGate->SetOutputState(State::Zero);
-        GetGame()->Add(outputGate);
+        AddOutput(child->GetName().ToStdWstring());
 
         // Go to the next panel
         child = child->GetNext();
     }
 }
+
+/**
+ * Add an output panel to the sensor by the name of its property.
+ * Names that aren't product properties are skipped.
+ * @param outputName Name of the property the panel shows
+ */
+void Sensor::AddOutput(const std::wstring& outputName)
+{
+    auto found = Product::NamesToProperties.find(outputName);
+    if (found != Product::NamesToProperties.end())
+    {
+        AddOutput(found->second);
+    }
+}
+
+/**
+ * Add an output panel to the sensor, along with the gate its pin drives
+ * @param property The property the panel shows
+ */
+void Sensor::AddOutput(Product::Properties property)
+{
+    mOutputs.push_back(property);
+
+    // Panels for content properties show the content's image
+    auto contentImage = Product::PropertiesToContentImages.find(property);
+    if (contentImage != Product::PropertiesToContentImages.end())
+    {
+        mPanelImages[property] = ImageCache::GetBitmap(DirectoryContainingImages + contentImage->second);
+    }
+
+    // Create a new OutputLogicGate for the panel
+    auto outputGate = GetGame()->GetLevelArena()->Make<OutputLogicGate>(GetGame());
+    mOutputGates.push_back(outputGate);
+    outputGate->SetOutputState(State::Zero);
+    GetGame()->Add(outputGate);
+
+    PlaceOutputGates();
+}
@@ -12,6 +12,7 @@
 
 #include "Item.h"
 #include "ItemEmpty.h"
+#include "Product.h"
 
 /**
  * Sensor class
@@ -19,31 +20,44 @@
 class Sensor : public Item
 {
 private:
-    std::vector<std::wstring> mOutputs; ///< The outputs supported by the sensor
-    std::map<std::wstring, wxBitmap> mPanelImages; ///< Map that stores bitmaps of panel images and their names
-    wxBitmap mCameraBitmap; ///< Camera's bitmap
-    wxBitmap mCableBitmap; ///< Cable bitmap
+    std::vector<Product::Properties> mOutputs; ///< The outputs supported by the sensor
+    std::map<Product::Properties, std::shared_ptr<wxBitmap>> mPanelImages; ///< Map that stores bitmaps of panel images and their names
+    std::shared_ptr<wxBitmap> mCameraBitmap; ///< Camera's bitmap
+    std::shared_ptr<wxBitmap> mCableBitmap; ///< Cable bitmap
     bool mImagesLoaded = false; ///< Bool that checks if images are already loaded
     std::vector<std::shared_ptr<OutputLogicGate>> mOutputGates; ///< Output gates for the sensor
     std::vector<wxRect> mPanelLocations; ///< Member variable to store panel locations
 
+    void PlaceOutputGates();
+
 public:
     Sensor(Game* game, std::vector<std::wstring> outputs);
 
-    /// Draws the sensor
-    void Draw(wxGraphicsContext* graphics) override;
+    /// The sensor is all in the static layer, so records nothing
+    void Record(RenderList* list) override {}
+
+    void SetLocation(double x, double y) override;
+
+    /// Draws the sensor into the static layer
+    void DrawStatic(wxGraphicsContext* graphics) override;
 
     /// Loads the sensor from the XML file
     void XmlLoad(wxXmlNode* node) override;
 
+    /// Adds an output panel and its output gate to the sensor
+    void AddOutput(const std::wstring& outputName);
+
+    /// Adds an output panel and its output gate to the sensor
+    void AddOutput(Product::Properties property);
+
 
     /// Resets all the pins to their Zero state
     void ResetAllPins();
 
     /// Activates output pin to its correct state
-    void ActivateOutputPin(const std::wstring& property);
+    void ActivateOutputPin(Product::Properties property);
 
-    /// Checks if a product is in range and returns boolean
+    /// Checks if a product was in range at any time this tick and returns boolean
     bool IsProductInRange(const Product& product);
 
     /**
@@ -105,23 +105,23 @@ private:
         {
             case Product::Properties::Red:
                 //std::cout << " - Color: Red" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"red");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Red);
                 break;
             case Product::Properties::Green:
                 //std::cout << " - Color: Green" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"green");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Green);
                 break;
             case Product::Properties::Blue:
                 //std::cout << " - Color: Blue" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"blue");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Blue);
                 break;
             case Product::Properties::White:
                 //std::cout << " - Color: White" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"white");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::White);
                 break;
             default:
                 //std::cout << " - Color: None" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"none");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::None);
                 break;
         }
 
@@ -130,15 +130,15 @@ private:
         {
             case Product::Properties::Square:
                 //std::cout << " - Shape: Square" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"square");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Square);
                 break;
             case Product::Properties::Circle:
                 //std::cout << " - Shape: Circle" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"circle");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Circle);
                 break;
             case Product::Properties::Diamond:
                 //std::cout << " - Shape: Diamond" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"diamond");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Diamond);
                 break;
             default:
                 break;
@@ -149,19 +149,19 @@ private:
         {
             case Product::Properties::Izzo:
                 //std::cout << " - Content: Izzo" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"izzo");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Izzo);
                 break;
             case Product::Properties::Smith:
                 //std::cout << " - Content: Smith" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"smith");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Smith);
                 break;
             case Product::Properties::Basketball:
                 //std::cout << " - Content: Basketball" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"basketball");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Basketball);
                 break;
             case Product::Properties::Football:
                 //std::cout << " - Content: Football" << std::endl;
-                mCurrentSensor->ActivateOutputPin(L"football");
+                mCurrentSensor->ActivateOutputPin(Product::Properties::Football);
                 break;
             default:
                 break;
@@ -5,9 +5,16 @@
 
 #include "pch.h"
 #include "Sparty.h"
+#include "Game.h"
 #include "InputLogicGate.h"
 #include "Product.h"
 #include "SpartyProductVisitor.h"
+#include "ImageCache.h"
+#include "RenderList.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 /// Image directory
 const std::wstring DirectoryContainingImages = L"resources/images/";
@@ -28,6 +35,10 @@ wxPoint2DDouble SpartyBootPivot = wxPoint2DDouble(0.5, 0.55);
 /// The maximum rotation for Sparty's boot in radians
 const double SpartyBootMaxRotation = 0.8;
 
+/// Number of pre-rendered boot rotations from no rotation
+/// to SpartyBootMaxRotation, inclusive
+const int SpartyBootFrameCount = 16;
+
 /// The point in the kick animation when the product
 /// actually is kicked. If the kick duration is 0.25,
 /// we kick when 0.25 * 0.35 seconds have elapsed.
@@ -66,88 +77,88 @@ const wxColour ConnectionColorUnknown= wxColour(128, 128, 128);
  * @param kickSpeed The speed of the kick in pixels per second
  */
 Sparty::Sparty(Game* game, double height, wxPoint pin, double kickDuration, double kickSpeed)
-    : Item(game),
+    : Item(game), mPin(pin), mKickDuration(kickDuration), mKickSpeed(kickSpeed),
       mIsKicking(false), mKickTime(0), mHeight(height), mCurrentBootRotation(0),
       mProductKicked(), mPreviousState(State::Unknown)
 
 {
-    mBootBitmap = std::make_unique<wxBitmap>(SpartyBootImage, wxBITMAP_TYPE_ANY);
-    mFrontBitmap = std::make_unique<wxBitmap>(SpartyFrontImage, wxBITMAP_TYPE_ANY);
-
-    mBackBitmap = std::make_unique<wxBitmap>(SpartyBackImage, wxBITMAP_TYPE_ANY);
+    mBootBitmap = ImageCache::GetBitmap(SpartyBootImage);
+    mFrontBitmap = ImageCache::GetBitmap(SpartyFrontImage);
+    mBackBitmap = ImageCache::GetBitmap(SpartyBackImage);
 
-    mInputPin = std::make_shared<InputLogicGate>(game); //Create the input pin
+    mInputPin = game->GetLevelArena()->Make<InputLogicGate>(game); //Create the input pin
+    mInputPin->SetLocation(mPin.x, mPin.y);
     game->Add(mInputPin); //Add it to the game
 }
 
 /**
  * Draws Sparty on the given graphics context.
- * NOTE: UNSURE IF THIS IS THE INTENDED SOLUTION OR TO HAVE A SEPERATE CLASS FOR THE LEG.... MIGHT BE A GOOD IDEA
  *
  * @param graphics The graphics context to draw on.
  */
 void Sparty::Draw(wxGraphicsContext* graphics)
 {
+    RenderList list;
+    Record(&list);
+    list.Replay(graphics);
+}
+
+/**
+ * Records the commands that draw Sparty.
+ * NOTE: UNSURE IF THIS IS THE INTENDED SOLUTION OR TO HAVE A SEPERATE CLASS FOR THE LEG.... MIGHT BE A GOOD IDEA
+ *
+ * @param list The render list to record into.
+ */
+void Sparty::Record(RenderList* list)
+{
+    wxColour color = ConnectionColorUnknown;
     auto state = mInputPin->GetInputPinValue();
     if (state == State::One)
     {
-        graphics->SetPen(wxPen(ConnectionColorOne, LineWidth));}
+        color = ConnectionColorOne;
+    }
     else if (state == State::Zero)
     {
-        graphics->SetPen(wxPen(ConnectionColorZero, LineWidth));
+        color = ConnectionColorZero;
     }
-    else
+
+    // Draw the wire from the pin around the scoreboard to sparty
+    auto wire = GetWirePoints();
+    list->MoveTo(wire[0]);
+    for (size_t i = 1; i < wire.size(); i++)
     {
-        graphics->SetPen(wxPen(ConnectionColorUnknown, LineWidth));
+        list->LineTo(wire[i]);
     }
-
-    double lineEndX = mPin.x + DefaultLineLength; // adjust as needed for spacing
-    double lineEndY = mPin.y;
-
-    // Now drawing vertical wire connecting from pin
-    double scoreboardHeight = 70;
-    double halfOfScreenHeight = 310 + scoreboardHeight;
-    graphics->StrokeLine(lineEndX, lineEndY,
-                         lineEndX, lineEndY - halfOfScreenHeight);
-
-    // Draw horizontal wire connecting remaining wire from scoreboard
-    double conveyorY = 400;
-    double endingUpVerticalWire = 320;
-    graphics->StrokeLine(lineEndX, lineEndY - halfOfScreenHeight,
-                         lineEndX - ScoreboardEnd - endingUpVerticalWire, lineEndY - halfOfScreenHeight);
-
-    // Draw the vertical wire down from the remaining wire to around half of sparty
-    double quarterofSpartyHeight = mHeight/4;
-    graphics->StrokeLine(lineEndX - ScoreboardEnd - endingUpVerticalWire, lineEndY - halfOfScreenHeight,
-                         lineEndX - ScoreboardEnd - endingUpVerticalWire, lineEndY - quarterofSpartyHeight);
-
-    // Now draw remaining wire to connect sparty.
-    double distanceToSparty = 105;
-    graphics->StrokeLine(lineEndX - ScoreboardEnd - endingUpVerticalWire, lineEndY - quarterofSpartyHeight,
-                         lineEndX - ScoreboardEnd - endingUpVerticalWire - distanceToSparty, lineEndY - quarterofSpartyHeight);
-
-    double aspectRatio = mBootBitmap->GetWidth() / (1.0 * mBootBitmap->GetHeight());
-    double newWidth = mHeight * aspectRatio;
+    list->StrokePath(color, LineWidth);
 
     double pivotX = GetX();
     double pivotY = GetY();
 
     //Sparty back foot
-    graphics->DrawBitmap(*mBackBitmap, GetX() - newWidth / 2, GetY() - mHeight / 2, newWidth, mHeight);
+    double backAspectRatio = mBootBitmap->GetWidth() / (1.0 * mBootBitmap->GetHeight());
+    double backNewWidth = mHeight * backAspectRatio;
+    list->DrawBitmap(mBackBitmap, GetX() - backNewWidth / 2, GetY() - mHeight / 2, backNewWidth, mHeight);
 
     //std::cout << "Current Boot Rotation: " << mCurrentBootRotation << std::endl;
     //std::cout << "Pivot: (" << pivotX << ", " << pivotY << ")" << std::endl;
     //std::cout << "Boot Bitmap Size: (" << mBootBitmap->GetWidth() << ", " << mBootBitmap->GetHeight() << ")" << std::endl;
 
-    graphics->PushState();
-    graphics->Translate(pivotX, pivotY);
-    graphics->Rotate(mCurrentBootRotation);
-    graphics->DrawBitmap(*mBootBitmap,  - newWidth / 2, -mHeight / 2, newWidth, mHeight);
-    graphics->PopState();
+    // Blit the nearest pre-rendered rotation of the boot instead of rotating it every frame
+    double scale = GetGame()->GetScale();
+    if (mBootFrames.empty() || scale != mBootFrameScale || mHeight != mBootFrameHeight)
+    {
+        RenderBootFrames(scale);
+    }
+
+    int frame = int(std::lround(mCurrentBootRotation / SpartyBootMaxRotation * (SpartyBootFrameCount - 1)));
+    frame = std::clamp(frame, 0, SpartyBootFrameCount - 1);
+    const auto& boot = mBootFrames[frame];
+    list->DrawBitmap(boot.mBitmap, pivotX + boot.mRect.m_x,
+                     pivotY + boot.mRect.m_y, boot.mRect.m_width, boot.mRect.m_height);
 
     double frontAspectRatio = mFrontBitmap->GetWidth() / (1.0 * mFrontBitmap->GetHeight());
     double frontNewWidth = mHeight * frontAspectRatio;
-    graphics->DrawBitmap(*mFrontBitmap, GetX() - frontNewWidth / 2, GetY() - mHeight / 2, frontNewWidth, mHeight);
+    list->DrawBitmap(mFrontBitmap, GetX() - frontNewWidth / 2, GetY() - mHeight / 2, frontNewWidth, mHeight);
     int bootY = int(mHeight * SpartyBootPercentage);
     /*
     wxPen bootablePen(*wxGREEN, 3);
@@ -157,6 +168,161 @@ void Sparty::Draw(wxGraphicsContext* graphics)
     */
 }
 
+/**
+ * Pre-render the boot at evenly spaced rotations at a scale.
+ *
+ * Each frame only covers the opaque part of the boot, rotated
+ * about the pivot, at the size it takes in device pixels.
+ * @param scale Device pixels per virtual pixel
+ */
+void Sparty::RenderBootFrames(double scale)
+{
+    mBootFrames.clear();
+    mBootFrameScale = scale;
+    mBootFrameHeight = mHeight;
+
+    // Find the part of the boot image that is not transparent
+    wxImage image = *ImageCache::GetImage(SpartyBootImage);
+    if (!image.HasAlpha())
+    {
+        image.InitAlpha();
+    }
+
+    int minX = image.GetWidth(), minY = image.GetHeight(), maxX = -1, maxY = -1;
+    for (int y = 0; y < image.GetHeight(); y++)
+    {
+        for (int x = 0; x < image.GetWidth(); x++)
+        {
+            if (image.GetAlpha(x, y) > 0)
+            {
+                minX = std::min(minX, x);
+                minY = std::min(minY, y);
+                maxX = std::max(maxX, x);
+                maxY = std::max(maxY, y);
+            }
+        }
+    }
+
+    if (maxX < 0)
+    {
+        minX = minY = 0;
+        maxX = image.GetWidth() - 1;
+        maxY = image.GetHeight() - 1;
+    }
+
+    // Size and opaque part of the boot relative to the pivot in virtual pixels
+    double pixelSize = mHeight / image.GetHeight();
+    double bootWidth = image.GetWidth() * pixelSize;
+    double left = -bootWidth / 2 + minX * pixelSize;
+    double top = -mHeight / 2 + minY * pixelSize;
+    double right = -bootWidth / 2 + (maxX + 1) * pixelSize;
+    double bottom = -mHeight / 2 + (maxY + 1) * pixelSize;
+
+    for (int i = 0; i < SpartyBootFrameCount; i++)
+    {
+        double angle = SpartyBootMaxRotation * i / (SpartyBootFrameCount - 1);
+        double c = cos(angle);
+        double s = sin(angle);
+
+        // Bounding box of the rotated opaque part, with a pixel to spare for antialiasing
+        wxRect2DDouble rect;
+        bool first = true;
+        for (auto& corner : {wxPoint2DDouble(left, top), wxPoint2DDouble(right, top),
+                             wxPoint2DDouble(right, bottom), wxPoint2DDouble(left, bottom)})
+        {
+            wxPoint2DDouble rotated(corner.m_x * c - corner.m_y * s, corner.m_x * s + corner.m_y * c);
+            if (first)
+            {
+                rect = wxRect2DDouble(rotated.m_x, rotated.m_y, 0, 0);
+                first = false;
+            }
+            else
+            {
+                rect.Union(rotated);
+            }
+        }
+        rect.Inset(-1 / scale, -1 / scale);
+
+        int frameWidth = std::max(1, int(std::ceil(rect.m_width * scale)));
+        int frameHeight = std::max(1, int(std::ceil(rect.m_height * scale)));
+
+        wxImage frameImage(frameWidth, frameHeight, true);
+        frameImage.InitAlpha();
+        memset(frameImage.GetAlpha(), 0, (size_t)frameWidth * frameHeight);
+
+        {
+            // The image is updated when the context is destroyed
+            auto frameGraphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(frameImage));
+            frameGraphics->Scale(frameWidth / rect.m_width, frameHeight / rect.m_height);
+            frameGraphics->Translate(-rect.m_x, -rect.m_y);
+            frameGraphics->Rotate(angle);
+            frameGraphics->DrawBitmap(*mBootBitmap, -bootWidth / 2, -mHeight / 2, bootWidth, mHeight);
+        }
+
+        mBootFrames.push_back({std::make_shared<wxBitmap>(frameImage), rect});
+    }
+}
+
+/**
+ * Get the corners of the wire running from the input pin,
+ * up and around the scoreboard, and down to Sparty.
+ * @return Points along the wire in order
+ */
+std::vector<wxPoint2DDouble> Sparty::GetWirePoints()
+{
+    double lineEndX = mPin.x + DefaultLineLength; // adjust as needed for spacing
+    double lineEndY = mPin.y;
+
+    // Vertical wire up from the pin
+    double scoreboardHeight = 70;
+    double halfOfScreenHeight = 310 + scoreboardHeight;
+
+    // Horizontal wire past the scoreboard
+    double endingUpVerticalWire = 320;
+    double wireLeftX = lineEndX - ScoreboardEnd - endingUpVerticalWire;
+
+    // Vertical wire down to around half of sparty
+    double quarterofSpartyHeight = mHeight/4;
+
+    // Remaining wire to connect sparty
+    double distanceToSparty = 105;
+
+    return {
+        wxPoint2DDouble(lineEndX, lineEndY),
+        wxPoint2DDouble(lineEndX, lineEndY - halfOfScreenHeight),
+        wxPoint2DDouble(wireLeftX, lineEndY - halfOfScreenHeight),
+        wxPoint2DDouble(wireLeftX, lineEndY - quarterofSpartyHeight),
+        wxPoint2DDouble(wireLeftX - distanceToSparty, lineEndY - quarterofSpartyHeight)
+    };
+}
+
+/**
+ * Get the area Sparty's body draws over, wide enough
+ * for the boot at any rotation about its pivot.
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Sparty::GetBodyBounds()
+{
+    double bootWidth = mHeight * mBootBitmap->GetWidth() / (1.0 * mBootBitmap->GetHeight());
+    double frontWidth = mHeight * mFrontBitmap->GetWidth() / (1.0 * mFrontBitmap->GetHeight());
+    double radius = std::hypot(std::max(bootWidth, frontWidth) / 2, mHeight / 2);
+    return wxRect2DDouble(GetX() - radius, GetY() - radius, radius * 2, radius * 2);
+}
+
+/**
+ * Get the area Sparty and his wire draw over
+ * @return Bounding rectangle in pixels
+ */
+wxRect2DDouble Sparty::GetBounds()
+{
+    auto bounds = GetBodyBounds();
+    for (auto& point : GetWirePoints())
+    {
+        bounds.Union(point);
+    }
+    return bounds;
+}
+
 /**
  * Updates the state of Sparty.
  *
@@ -173,6 +339,19 @@ void Sparty::Update(double elapsed)
     if (mIsKicking)
     {
         AnimateKick(elapsed);
+        GetGame()->Invalidate(GetBodyBounds());
+    }
+
+    // The wire changes colour with the pin, repaint just the wire
+    if (currentState != mPreviousState)
+    {
+        auto wire = GetWirePoints();
+        for (size_t i = 1; i < wire.size(); i++)
+        {
+            wxRect2DDouble segment(wire[i - 1].m_x, wire[i - 1].m_y, 0, 0);
+            segment.Union(wire[i]);
+            GetGame()->Invalidate(segment);
+        }
     }
 
     mPreviousState = currentState;
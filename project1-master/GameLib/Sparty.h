@@ -25,6 +25,8 @@ public:
     bool IsProductInKickRange(const Product& product); ///< handles checking if a product is in the kick range
     void KickProduct(); ///< Handles kicking the product off the conveyor
     void Draw(wxGraphicsContext* graphics) override; ///< draws the sparty
+    void Record(RenderList* list) override; ///< records the commands that draw the sparty
+    wxRect2DDouble GetBounds() override; ///< area sparty and his wire draw over
 
     /**
     * Accept a visitor
@@ -68,15 +70,30 @@ private:
     double mKickSpeed; ///< Speed of the kick
     bool mIsKicking; ///< Whether Sparty is currently kicking
     double mKickTime; ///< Time elapsed in the current kick
-    std::unique_ptr<wxBitmap> mBootBitmap; ///< Bitmap for the boot image
-    std::unique_ptr<wxBitmap> mFrontBitmap; ///< Bitmap for the front image
-    std::unique_ptr<wxBitmap> mBackBitmap; ///< Bitmap for back foot
+    std::shared_ptr<wxBitmap> mBootBitmap; ///< Bitmap for the boot image
+    std::shared_ptr<wxBitmap> mFrontBitmap; ///< Bitmap for the front image
+    std::shared_ptr<wxBitmap> mBackBitmap; ///< Bitmap for back foot
     double mHeight; ///< Height desired for Sparty
     double mCurrentBootRotation; ///< Tracks the current rotation of the boot
     bool mProductKicked; ///< Tracks whether a product has already been kicked in the current cycle
     std::shared_ptr<InputLogicGate> mInputPin; ///< Sparty's input pin (Uses an invisible logic gate)
     State mPreviousState; ///< Tracks the previous state of the input pin
 
+    /// The boot pre-rendered at one rotation
+    struct BootFrame
+    {
+        std::shared_ptr<wxBitmap> mBitmap; ///< The rotated boot at device resolution
+        wxRect2DDouble mRect; ///< Where the frame goes relative to the pivot in virtual pixels
+    };
+
+    std::vector<BootFrame> mBootFrames; ///< Boot frames from no rotation to the most rotation
+    double mBootFrameScale = 0; ///< Scale the boot frames were rendered at
+    double mBootFrameHeight = 0; ///< Height of Sparty when the boot frames were rendered
+
+    std::vector<wxPoint2DDouble> GetWirePoints(); ///< corners of the wire from the input pin to sparty
+    wxRect2DDouble GetBodyBounds(); ///< area the boot can swing through
+    void RenderBootFrames(double scale); ///< pre-renders the rotated boot at a scale
+
 };
 
 
@@ -0,0 +1,88 @@
+/**
+ * @file SweptInterval.cpp
+ * @author Mehrshad Bagherebadian
+ */
+
+#include "pch.h"
+#include "SweptInterval.h"
+
+#include <algorithm>
+
+/**
+ * Constructor
+ * @param enter Fraction of the tick at which the overlap begins
+ * @param exit Fraction of the tick at which the overlap ends
+ */
+SweptInterval::SweptInterval(double enter, double exit) : mEnter(enter), mExit(exit)
+{
+}
+
+/**
+ * Sweep a span moving linearly from [low0, high0] to [low1, high1]
+ * over one tick against the fixed window [windowLow, windowHigh].
+ *
+ * Boundaries are inclusive, so a span just touching the window overlaps it.
+ *
+ * @param low0 Low edge of the span at the start of the tick
+ * @param high0 High edge of the span at the start of the tick
+ * @param low1 Low edge of the span at the end of the tick
+ * @param high1 High edge of the span at the end of the tick
+ * @param windowLow Low edge of the window
+ * @param windowHigh High edge of the window
+ * @return Interval of the tick during which the span overlaps the window
+ */
+SweptInterval SweptInterval::Sweep(double low0, double high0, double low1, double high1,
+                                   double windowLow, double windowHigh)
+{
+    SweptInterval interval;
+
+    // The high edge of the span has to be at or past the low edge of the window...
+    interval.ClipAtLeastZero(high0 - windowLow, high1 - windowLow);
+
+    // ...and the low edge of the span at or before the high edge of the window
+    interval.ClipAtLeastZero(windowHigh - low0, windowHigh - low1);
+
+    return interval;
+}
+
+/**
+ * Restrict the interval to the times where a linear function
+ * f(t) = f0 + (f1 - f0) t is at least zero.
+ * @param f0 Value of the function at the start of the tick
+ * @param f1 Value of the function at the end of the tick
+ */
+void SweptInterval::ClipAtLeastZero(double f0, double f1)
+{
+    double slope = f1 - f0;
+    if (slope == 0)
+    {
+        if (f0 < 0)
+        {
+            // Never satisfied during this tick
+            mEnter = 1;
+            mExit = 0;
+        }
+        return;
+    }
+
+    // Time at which the function crosses zero
+    double crossing = -f0 / slope;
+    if (slope > 0)
+    {
+        mEnter = std::max(mEnter, crossing);
+    }
+    else
+    {
+        mExit = std::min(mExit, crossing);
+    }
+}
+
+/**
+ * Restrict this interval to the times it shares with another one
+ * @param other The interval to intersect with
+ */
+void SweptInterval::Intersect(const SweptInterval& other)
+{
+    mEnter = std::max(mEnter, other.mEnter);
+    mExit = std::min(mExit, other.mExit);
+}
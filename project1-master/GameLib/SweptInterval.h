@@ -0,0 +1,71 @@
+/**
+ * @file SweptInterval.h
+ * @author Mehrshad Bagherebadian
+ *
+ * Time interval during a tick in which a moving span overlaps a fixed window
+ */
+
+#ifndef SWEPTINTERVAL_H
+#define SWEPTINTERVAL_H
+
+/**
+ * Time interval during a single update tick in which a moving
+ * object overlaps a fixed detection window.
+ *
+ * Times are fractions of the tick: 0 is where the object was at the
+ * start of the update, 1 is where it is at the end. Motion over the tick
+ * is treated as linear, so an object that jumps clean over a window in
+ * one large step is still reported as having crossed it.
+ */
+class SweptInterval
+{
+private:
+    double mEnter = 0; ///< Fraction of the tick at which the overlap begins
+    double mExit = 1; ///< Fraction of the tick at which the overlap ends
+
+public:
+    /// Constructor, the whole tick
+    SweptInterval() = default;
+
+    SweptInterval(double enter, double exit);
+
+    static SweptInterval Sweep(double low0, double high0, double low1, double high1,
+                               double windowLow, double windowHigh);
+
+    void ClipAtLeastZero(double f0, double f1);
+
+    void Intersect(const SweptInterval& other);
+
+    /**
+     * Is there no time during the tick at which the overlap holds?
+     * @return true if the interval is empty
+     */
+    bool IsEmpty() const { return mEnter > mExit; }
+
+    /**
+     * Get the fraction of the tick at which the overlap begins
+     * @return Enter time in [0, 1]
+     */
+    double GetEnter() const { return mEnter; }
+
+    /**
+     * Get the fraction of the tick at which the overlap ends
+     * @return Exit time in [0, 1]
+     */
+    double GetExit() const { return mExit; }
+
+    /**
+     * Did the overlap begin during this tick rather than before it?
+     * @return true if the object was outside the window at the start of the tick
+     */
+    bool Entered() const { return !IsEmpty() && mEnter > 0; }
+
+    /**
+     * Did the overlap end during this tick?
+     * @return true if the object is outside the window at the end of the tick
+     */
+    bool Exited() const { return !IsEmpty() && mExit < 1; }
+};
+
+
+#endif //SWEPTINTERVAL_H
@@ -0,0 +1,96 @@
+/**
+ * @file WireTable.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include "pch.h"
+#include "WireTable.h"
+
+#include <algorithm>
+
+/**
+ * Add a wire
+ * @param output The output pin the wire leaves
+ * @param input The input pin the wire has caught
+ */
+void WireTable::Add(PinHandle output, PinHandle input)
+{
+    mWires.push_back({output, input});
+    mDirty = true;
+    mVersion++;
+}
+
+/**
+ * Remove the wire between two pins
+ * @param output The output pin the wire leaves
+ * @param input The input pin the wire has caught
+ */
+void WireTable::Remove(PinHandle output, PinHandle input)
+{
+    auto end = std::remove_if(mWires.begin(), mWires.end(), [output, input](const Wire& wire)
+    {
+        return wire.mOutput == output && wire.mInput == input;
+    });
+
+    if (end != mWires.end())
+    {
+        mWires.erase(end, mWires.end());
+        mDirty = true;
+        mVersion++;
+    }
+}
+
+/**
+ * Remove every wire to or from a pin, as when the pin is destroyed
+ * @param pin The pin
+ */
+void WireTable::RemovePin(PinHandle pin)
+{
+    auto end = std::remove_if(mWires.begin(), mWires.end(), [pin](const Wire& wire)
+    {
+        return wire.mOutput == pin || wire.mInput == pin;
+    });
+
+    if (end != mWires.end())
+    {
+        mWires.erase(end, mWires.end());
+        mDirty = true;
+        mVersion++;
+    }
+}
+
+/**
+ * Group the caught input pins by output pin.
+ *
+ * A counting sort on the output pin slot index, so each output pin's
+ * caught pins stay in the order they were caught.
+ */
+void WireTable::Rebuild()
+{
+    wxUint32 rows = 0;
+    for (const auto& wire : mWires)
+    {
+        rows = std::max(rows, wire.mOutput.GetIndex() + 1);
+    }
+
+    // Count the wires leaving each output pin, then turn the counts into where each group starts
+    mOffsets.assign(rows + 1, 0);
+    for (const auto& wire : mWires)
+    {
+        mOffsets[wire.mOutput.GetIndex() + 1]++;
+    }
+
+    for (size_t i = 1; i < mOffsets.size(); i++)
+    {
+        mOffsets[i] += mOffsets[i - 1];
+    }
+
+    std::vector<wxUint32> next(mOffsets.begin(), mOffsets.end() - 1);
+    mTargets.resize(mWires.size());
+    for (const auto& wire : mWires)
+    {
+        mTargets[next[wire.mOutput.GetIndex()]++] = wire.mInput;
+    }
+
+    mDirty = false;
+}
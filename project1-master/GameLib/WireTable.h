@@ -0,0 +1,146 @@
+/**
+ * @file WireTable.h
+ * @author Conner O'Sullivan
+ *
+ * The wires between the pins of a game
+ */
+
+#ifndef WIRETABLE_H
+#define WIRETABLE_H
+
+#include "PinTable.h"
+
+#include <vector>
+
+/**
+ * The wires between the pins of a game, each from an output pin to
+ * the input pin it has caught.
+ *
+ * The wires are kept as a list in the order they were made. For
+ * reading, they are grouped by output pin in compressed sparse row
+ * form: mTargets holds the caught input pins of every output pin one
+ * group after another, and mOffsets holds where each output pin's
+ * group starts, indexed by the pin's slot in the PinTable. The groups
+ * are rebuilt the first time they are read after a wire is made or
+ * removed, so drawing streams through one contiguous array.
+ */
+class WireTable
+{
+public:
+    /**
+     * The input pins an output pin has caught, in the order they were caught
+     */
+    class Caught
+    {
+    private:
+        const PinHandle* mBegin = nullptr; ///< First caught pin
+        const PinHandle* mEnd = nullptr; ///< One past the last caught pin
+
+    public:
+        /// Constructor, no caught pins
+        Caught() = default;
+
+        /**
+         * Constructor
+         * @param begin First caught pin
+         * @param end One past the last caught pin
+         */
+        Caught(const PinHandle* begin, const PinHandle* end) : mBegin(begin), mEnd(end) {}
+
+        /**
+         * Get the first caught pin
+         * @return Pointer to the first handle
+         */
+        const PinHandle* begin() const { return mBegin; }
+
+        /**
+         * Get one past the last caught pin
+         * @return Pointer past the last handle
+         */
+        const PinHandle* end() const { return mEnd; }
+
+        /**
+         * Get the number of caught pins
+         * @return Number of pins
+         */
+        size_t size() const { return mEnd - mBegin; }
+
+        /**
+         * Are there no caught pins?
+         * @return true if there are none
+         */
+        bool empty() const { return mBegin == mEnd; }
+    };
+
+private:
+    /// A wire from an output pin to an input pin
+    struct Wire
+    {
+        PinHandle mOutput; ///< The output pin the wire leaves
+        PinHandle mInput; ///< The input pin the wire has caught
+    };
+
+    std::vector<Wire> mWires; ///< Every wire, in the order they were made
+
+    /// Start of each output pin's group in mTargets, by slot index, with the end of the last group after them
+    std::vector<wxUint32> mOffsets;
+
+    std::vector<PinHandle> mTargets; ///< The caught input pins, grouped by output pin
+
+    bool mDirty = false; ///< Have the wires changed since the groups were built?
+
+    wxUint32 mVersion = 0; ///< Counts every change to the wires
+
+    void Rebuild();
+
+public:
+    /// Constructor, no wires
+    WireTable() = default;
+
+    /// Copy constructor (disabled)
+    WireTable(const WireTable&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const WireTable&) = delete;
+
+    void Add(PinHandle output, PinHandle input);
+    void Remove(PinHandle output, PinHandle input);
+    void RemovePin(PinHandle pin);
+
+    /**
+     * Get the input pins an output pin has caught
+     * @param output The output pin
+     * @return The caught input pins
+     */
+    Caught GetCaught(PinHandle output)
+    {
+        if (mDirty)
+        {
+            Rebuild();
+        }
+
+        auto index = output.GetIndex();
+        if (index + 1 >= mOffsets.size())
+        {
+            return Caught();
+        }
+
+        return Caught(mTargets.data() + mOffsets[index], mTargets.data() + mOffsets[index + 1]);
+    }
+
+    /**
+     * Get the number of wires
+     * @return Number of wires
+     */
+    size_t GetCount() const { return mWires.size(); }
+
+    /**
+     * Get a number that changes every time a wire is made or removed,
+     * so a pin can tell whether its wires may have changed
+     * @return The version of the wires
+     */
+    wxUint32 GetVersion() const { return mVersion; }
+};
+
+
+#endif //WIRETABLE_H
@@ -5,7 +5,9 @@
 
 #include "pch.h"
 #include "XORLogicGate.h"
+#include "Game.h"
 #include "LogicGate.h"
+#include "RenderList.h"
 
 using namespace std;
 
@@ -34,22 +36,20 @@ XORLogicGate::XORLogicGate(Game* game) : LogicGate(game)
     const wxPoint InputPinLocation2((x - w / 1.3), (y - h / 4.5));
     const wxPoint OutputPinLocation1((x + w / 1.25), (y));
 
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation1));
-    CreateInputPin(std::make_shared<PinInput>(this, InputPinLocation2));
-    CreateOutputPin(std::make_shared<PinOutput>(this, OutputPinLocation1));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation1));
+    CreateInputPin(GetGame()->GetLevelArena()->Make<PinInput>(this, InputPinLocation2));
+    CreateOutputPin(GetGame()->GetLevelArena()->Make<PinOutput>(this, OutputPinLocation1));
 }
 
 /**
- * @brief Draws the XOR logic gate.
+ * @brief Records the XOR logic gate.
  *
- * This function creates and draws the shape of the XOR gate on the given
- * graphics context using Bezier curves.
+ * This function records the shape of the XOR gate as a path made of
+ * Bezier curves.
+ * @param list The render list to record into
  */
-void XORLogicGate::Draw(wxGraphicsContext* gc)
+void XORLogicGate::Record(RenderList* list)
 {
-    // Create a path for the OR gate shape
-    auto orGatePath = gc->CreatePath();
-
     // Get the location and size
     auto x = GetX();
     auto y = GetY();
@@ -66,15 +66,15 @@ void XORLogicGate::Draw(wxGraphicsContext* gc)
     auto controlPointOffset2 = wxPoint2DDouble(w * 0.75, 0);
     auto controlPointOffset3 = wxPoint2DDouble(w * 0.2, 0);
 
-    // Create the path for the OR gate
-    orGatePath.MoveToPoint(p1);
-    orGatePath.AddCurveToPoint(p1 + controlPointOffset1, p1 + controlPointOffset2, p2);
-    orGatePath.AddCurveToPoint(p3 + controlPointOffset2, p3 + controlPointOffset1, p3);
-    orGatePath.AddCurveToPoint(p3 + controlPointOffset3, p1 + controlPointOffset3, p1);
-    orGatePath.CloseSubpath();
+    // ---- Draw the OR Gate ---- //
+    list->MoveTo(p1);
+    list->CurveTo(p1 + controlPointOffset1, p1 + controlPointOffset2, p2);
+    list->CurveTo(p3 + controlPointOffset2, p3 + controlPointOffset1, p3);
+    list->CurveTo(p3 + controlPointOffset3, p1 + controlPointOffset3, p1);
+    list->ClosePath();
+    list->FillPath(*wxBLACK, *wxWHITE);
 
-    // ---- Create the XOR Curve ---- //
-    auto xorCurvePath = gc->CreatePath();
+    // ---- Draw the XOR Curve ---- //
 
     // Define an offset to shift the curve to the left
     wxPoint2DDouble offset(-w * 0.1, 0); // Shift left by 10% of width
@@ -85,26 +85,12 @@ void XORLogicGate::Draw(wxGraphicsContext* gc)
     wxPoint2DDouble xorControlPoint2 = p1 + controlPointOffset3 + offset;
     wxPoint2DDouble xorEndPoint = p1 + offset;
 
-    // Move to the start point of XOR curve
-    xorCurvePath.MoveToPoint(xorStartPoint);
-
-    // Add the Bezier curve
-    xorCurvePath.AddCurveToPoint(xorControlPoint1, xorControlPoint2, xorEndPoint);
-
-    // ---- Draw the OR Gate ---- //
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxWHITE_BRUSH);
-    gc->DrawPath(orGatePath); // Draw OR gate
-
-    // ---- Draw the XOR Curve ---- //
-    wxPen thickPen(wxColour(0, 0, 0), 2);
-    gc->SetPen(thickPen);
-    gc->StrokePath(xorCurvePath); // Draw XOR curve
+    list->MoveTo(xorStartPoint);
+    list->CurveTo(xorControlPoint1, xorControlPoint2, xorEndPoint);
+    list->StrokePath(*wxBLACK, 2);
 
     // ---- Inputs and Outputs ---- //
-    DrawPins(gc);
-    gc->SetPen(*wxBLACK_PEN);
-    gc->SetBrush(*wxBLACK_BRUSH);
+    RecordPins(list);
 }
 
 
@@ -120,12 +106,12 @@ void XORLogicGate::Draw(wxGraphicsContext* gc)
 void XORLogicGate::ComputeOutput()
 {
     // Get input pins
-    auto inputPins = GetPinInputs();
-    auto input1 = inputPins[0];
-    auto input2 = inputPins[1];
+    auto& inputPins = GetPinInputs();
+    auto& input1 = inputPins[0];
+    auto& input2 = inputPins[1];
     
     // Get output pin (XOR gate has single output)
-    auto outputPin = GetOutputPins()[0];
+    auto& outputPin = GetOutputPins()[0];
     
     // If either input is unknown, output is unknown
     if (input1->GetState() == State::Unknown || input2->GetState() == State::Unknown)
@@ -38,11 +38,11 @@ public:
  void operator=(const XORLogicGate&) = delete;
 
  /**
-  * @brief Draw the XOR Logic Gate.
+  * @brief Record the XOR Logic Gate.
   *
-  * @param gc Pointer to the wxGraphicsContext used for drawing.
+  * @param list The render list to record into.
   */
- void Draw(wxGraphicsContext* gc) override;
+ void Record(RenderList* list) override;
 
  /**
  * Accept a visitor
@@ -0,0 +1,41 @@
+/**
+ * @file main.cpp
+ * @author Conner O'Sullivan
+ *
+ * Command line tool that compiles level XML files into compiled levels
+ *
+ * Usage: LevelCompiler level1.xml level1.lvl [level2.xml level2.lvl ...]
+ */
+
+#include <pch.h>
+#include <LevelCompiler.h>
+#include <wx/init.h>
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    wxInitializer initializer;
+    if (!initializer.IsOk())
+    {
+        std::cerr << "Unable to initialize wxWidgets" << std::endl;
+        return 1;
+    }
+
+    if (argc < 3 || argc % 2 == 0)
+    {
+        std::cerr << "Usage: LevelCompiler level.xml level.lvl [level.xml level.lvl ...]" << std::endl;
+        return 1;
+    }
+
+    for (int i = 1; i < argc; i += 2)
+    {
+        if (!LevelCompiler::Compile(wxString(argv[i]), wxString(argv[i + 1])))
+        {
+            std::cerr << "Unable to compile " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file ImageCacheTest.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <ImageCache.h>
+
+TEST(ImageCacheTest, Preload)
+{
+    ImageCache::Clear();
+
+    size_t lastDone = 0;
+    size_t lastTotal = 0;
+    ImageCache::Preload(L"resources/images/", [&lastDone, &lastTotal](size_t done, size_t total)
+    {
+        // Progress only ever moves forward
+        ASSERT_GT(done, lastDone);
+        lastDone = done;
+        lastTotal = total;
+    });
+
+    ASSERT_GT(lastTotal, 0u);
+    ASSERT_EQ(lastTotal, lastDone);
+
+    // Items get the images that were preloaded
+    auto image = ImageCache::GetImage(L"resources/images/sparty-boot.png");
+    ASSERT_TRUE(image->IsOk());
+    ASSERT_EQ(image, ImageCache::GetImage(L"resources/images/sparty-boot.png"));
+    ASSERT_TRUE(ImageCache::GetBitmap(L"resources/images/sparty-boot.png")->IsOk());
+
+    // Nothing is left to decode the second time
+    size_t calls = 0;
+    ImageCache::Preload(L"resources/images/", [&calls](size_t, size_t) { calls++; });
+    ASSERT_EQ(0u, calls);
+}
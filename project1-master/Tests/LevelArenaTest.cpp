@@ -0,0 +1,55 @@
+/**
+ * @file LevelArenaTest.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <Game.h>
+#include <LevelArena.h>
+
+#include <vector>
+
+TEST(LevelArenaTest, Release)
+{
+    LevelArena arena;
+    size_t initialSize = arena.GetBufferSize();
+
+    {
+        // More than fits in the first buffer
+        std::vector<std::shared_ptr<std::vector<int>>> objects;
+        for (size_t i = 0; i < initialSize / 16; i++)
+        {
+            objects.push_back(arena.Make<std::vector<int>>());
+        }
+
+        ASSERT_EQ(objects.size(), arena.GetLive());
+    }
+
+    ASSERT_EQ(0u, arena.GetLive());
+
+    // The buffer grows to hold everything the last level needed
+    arena.Release();
+    ASSERT_GT(arena.GetBufferSize(), initialSize);
+
+    auto object = arena.Make<std::vector<int>>(3, 7);
+    ASSERT_EQ(1u, arena.GetLive());
+    ASSERT_EQ(7, (*object)[2]);
+}
+
+TEST(LevelArenaTest, Game)
+{
+    Game game;
+    game.LoadLevel(L"resources/levels/level3.xml");
+    auto arena = game.GetLevelArena();
+    ASSERT_GT(arena->GetLive(), 0u);
+
+    // Loading a level again releases the arena and makes the level in it again
+    game.LoadLevel(L"resources/levels/level3.xml");
+    ASSERT_EQ(arena, game.GetLevelArena());
+    size_t bufferSize = arena->GetBufferSize();
+
+    game.LoadLevel(L"resources/levels/level3.xml");
+    ASSERT_EQ(arena, game.GetLevelArena());
+    ASSERT_EQ(bufferSize, arena->GetBufferSize());
+}
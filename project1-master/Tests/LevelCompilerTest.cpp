@@ -0,0 +1,81 @@
+/**
+ * @file LevelCompilerTest.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <wx/filename.h>
+#include <Game.h>
+#include <ItemCounter.h>
+#include <LevelCompiler.h>
+#include <LevelLoader.h>
+#include <MappedFile.h>
+
+#include <cstring>
+
+using namespace std;
+
+/// Number of the last level
+const int LastLevel = 8;
+
+/**
+ * Check that two games hold the same number of each item
+ * @param xmlGame Game loaded from the level XML
+ * @param compiledGame Game loaded from the compiled level
+ */
+static void TestSameItems(Game& xmlGame, Game& compiledGame)
+{
+    ItemCounter xmlCounter;
+    xmlGame.Accept(&xmlCounter);
+
+    ItemCounter compiledCounter;
+    compiledGame.Accept(&compiledCounter);
+
+    ASSERT_EQ(xmlCounter.GetNumSpartys(), compiledCounter.GetNumSpartys());
+    ASSERT_EQ(xmlCounter.GetNumSensors(), compiledCounter.GetNumSensors());
+    ASSERT_EQ(xmlCounter.GetNumBeams(), compiledCounter.GetNumBeams());
+    ASSERT_EQ(xmlCounter.GetNumProducts(), compiledCounter.GetNumProducts());
+    ASSERT_EQ(xmlCounter.GetNumConveyors(), compiledCounter.GetNumConveyors());
+    ASSERT_EQ(xmlCounter.GetNumScoreboards(), compiledCounter.GetNumScoreboards());
+    ASSERT_EQ(xmlCounter.GetNumLogicGates(), compiledCounter.GetNumLogicGates());
+}
+
+TEST(LevelCompilerTest, SameAsXml)
+{
+    for (int level = 0; level <= LastLevel; level++)
+    {
+        wxString xmlFile = wxString::Format(L"resources/levels/level%d.xml", level);
+        wxString compiledFile = wxFileName(wxFileName::GetTempDir(),
+                                           wxString::Format(L"level%d.lvl", level)).GetFullPath();
+
+        ASSERT_TRUE(LevelCompiler::Compile(xmlFile, compiledFile)) << xmlFile.ToStdString();
+
+        Game xmlGame;
+        xmlGame.LoadLevel(xmlFile);
+
+        Game compiledGame;
+        compiledGame.LoadLevel(compiledFile);
+
+        TestSameItems(xmlGame, compiledGame);
+
+        // Everything, including where each product starts, should draw the same
+        auto xmlImage = xmlGame.RenderImage(1150, 800);
+        auto compiledImage = compiledGame.RenderImage(1150, 800);
+        ASSERT_EQ(0, memcmp(xmlImage.GetData(), compiledImage.GetData(), 1150 * 800 * 3))
+            << xmlFile.ToStdString();
+
+        wxRemoveFile(compiledFile);
+    }
+}
+
+TEST(LevelCompilerTest, RejectsXml)
+{
+    MappedFile file(L"resources/levels/level1.xml");
+    ASSERT_TRUE(file.IsOk());
+    ASSERT_FALSE(LevelLoader::IsCompiledLevel(file));
+
+    MappedFile missing(L"resources/levels/missing.lvl");
+    ASSERT_FALSE(missing.IsOk());
+    ASSERT_FALSE(LevelLoader::IsCompiledLevel(missing));
+}
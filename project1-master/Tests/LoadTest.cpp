@@ -52,3 +52,33 @@ TEST_F(LoadTest, LoadLevel)
     ASSERT_EQ(1, numConveyors) << L"Number of conveyors loaded";
     ASSERT_EQ(1, numScoreboards) << L"Number of scoreboards loaded";
 }
+
+TEST_F(LoadTest, LoadNextLevel)
+{
+    // Finish level 1 and let the delay before the next level run out
+    Game game;
+    game.SetLevelNum(1);
+    game.LevelComplete();
+    for (int i = 0; i < 40; i++)
+    {
+        game.Update(0.1);
+    }
+
+    // The level built ahead of time should match loading level 2 directly
+    Game expected;
+    expected.SetLevelNum(2);
+    expected.LoadLevel(L"resources/levels/level2.xml");
+
+    ItemCounter counter;
+    game.Accept(&counter);
+    ItemCounter expectedCounter;
+    expected.Accept(&expectedCounter);
+
+    ASSERT_EQ(expectedCounter.GetNumSpartys(), counter.GetNumSpartys());
+    ASSERT_EQ(expectedCounter.GetNumSensors(), counter.GetNumSensors());
+    ASSERT_EQ(expectedCounter.GetNumBeams(), counter.GetNumBeams());
+    ASSERT_EQ(expectedCounter.GetNumProducts(), counter.GetNumProducts());
+    ASSERT_EQ(expectedCounter.GetNumConveyors(), counter.GetNumConveyors());
+    ASSERT_EQ(expectedCounter.GetNumScoreboards(), counter.GetNumScoreboards());
+    ASSERT_EQ(expectedCounter.GetNumLogicGates(), counter.GetNumLogicGates());
+}
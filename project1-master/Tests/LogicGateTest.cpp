@@ -9,6 +9,8 @@
 #include <OrLogicGate.h>
 #include <ItemVisitor.h>
 #include <SRLogicGate.h>
+#include <NotLogicGate.h>
+#include <OutputLogicGate.h>
 
 using namespace std;
 
@@ -63,4 +65,100 @@ TEST_F(LogicGateTest, srGateHitTest)
 
  // Test on the outside where the hit should not be detected
  ASSERT_FALSE(logicGate1->HitTest(500+logicGate1->GetWidth(), 500+logicGate1->GetHeight()));
-}
\ No newline at end of file
+}
+
+TEST_F(LogicGateTest, RemoveGate)
+{
+ Game game;
+
+ auto logicGate1 = std::make_shared<OrLogicGate>(&game);
+ logicGate1->SetLocation(300, 500);
+ game.Add(logicGate1);
+
+ auto logicGate2 = std::make_shared<OrLogicGate>(&game);
+ logicGate2->SetLocation(500, 500);
+ game.Add(logicGate2);
+
+ // Wire the first gate's output to the second gate's input
+ auto& output = logicGate1->GetOutputPins()[0];
+ auto& input = logicGate2->GetPinInputs()[0];
+ input->Catch(output.get(), input->GetAbsoluteLocation());
+ ASSERT_EQ(1u, output->GetNumCaught());
+
+ // Nothing is removed until the end of the tick
+ ASSERT_TRUE(game.RemoveAt(500, 500));
+ ASSERT_EQ(logicGate2, game.HitTestDefault(500, 500));
+
+ game.Update(0);
+ ASSERT_EQ(nullptr, game.HitTestDefault(500, 500));
+ ASSERT_EQ(logicGate1, game.HitTestDefault(300, 500));
+
+ // The wire into the removed gate went with it
+ ASSERT_EQ(0u, output->GetNumCaught());
+ ASSERT_EQ(nullptr, input->GetLine());
+}
+
+TEST_F(LogicGateTest, RemoveWires)
+{
+ Game game;
+
+ auto logicGate1 = std::make_shared<OrLogicGate>(&game);
+ logicGate1->SetLocation(300, 500);
+ game.Add(logicGate1);
+
+ auto logicGate2 = std::make_shared<OrLogicGate>(&game);
+ logicGate2->SetLocation(500, 500);
+ game.Add(logicGate2);
+
+ auto& output = logicGate1->GetOutputPins()[0];
+ for (auto& input : logicGate2->GetPinInputs())
+ {
+  input->Catch(output.get(), input->GetAbsoluteLocation());
+ }
+ ASSERT_EQ(2u, output->GetNumCaught());
+
+ // Removing at the output pin removes its wires but leaves both gates
+ auto pin = output->GetAbsoluteLocation();
+ ASSERT_TRUE(game.RemoveAt(pin.x, pin.y));
+ game.Update(0);
+
+ ASSERT_EQ(0u, output->GetNumCaught());
+ ASSERT_EQ(nullptr, logicGate2->GetPinInputs()[0]->GetLine());
+ ASSERT_EQ(nullptr, logicGate2->GetPinInputs()[1]->GetLine());
+ ASSERT_EQ(logicGate1, game.HitTestDefault(300, 500));
+ ASSERT_EQ(logicGate2, game.HitTestDefault(500, 500));
+}
+
+TEST_F(LogicGateTest, Propagate)
+{
+ Game game;
+
+ // Added in the opposite order to the signal, so a single pass isn't enough
+ auto not2 = std::make_shared<NotLogicGate>(&game);
+ not2->SetLocation(500, 500);
+ game.Add(not2);
+
+ auto not1 = std::make_shared<NotLogicGate>(&game);
+ not1->SetLocation(300, 500);
+ game.Add(not1);
+
+ auto source = std::make_shared<OutputLogicGate>(&game);
+ source->SetLocation(100, 500);
+ game.Add(source);
+
+ auto& input1 = not1->GetPinInputs()[0];
+ input1->Catch(source->GetOutputPins()[0].get(), input1->GetAbsoluteLocation());
+ auto& input2 = not2->GetPinInputs()[0];
+ input2->Catch(not1->GetOutputPins()[0].get(), input2->GetAbsoluteLocation());
+
+ // The signal goes through the whole circuit in one update, without drawing
+ source->SetOutputState(State::One);
+ game.Update(0);
+ ASSERT_EQ(State::Zero, not1->GetOutputPins()[0]->GetState());
+ ASSERT_EQ(State::One, not2->GetOutputPins()[0]->GetState());
+
+ source->SetOutputState(State::Zero);
+ game.Update(0);
+ ASSERT_EQ(State::One, not1->GetOutputPins()[0]->GetState());
+ ASSERT_EQ(State::Zero, not2->GetOutputPins()[0]->GetState());
+}
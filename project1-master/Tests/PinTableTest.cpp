@@ -0,0 +1,59 @@
+/**
+ * @file PinTableTest.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <Game.h>
+#include <OrLogicGate.h>
+#include <PinTable.h>
+
+TEST(PinTableTest, Handles)
+{
+    PinTable table;
+    ASSERT_EQ(nullptr, table.Get(PinHandle()));
+
+    // The table only stores the pointers, so any address will do
+    Pin* pin1 = reinterpret_cast<Pin*>(16);
+    Pin* pin2 = reinterpret_cast<Pin*>(32);
+
+    auto handle1 = table.Add(pin1);
+    ASSERT_FALSE(handle1.IsNull());
+    ASSERT_EQ(pin1, table.Get(handle1));
+    ASSERT_EQ(1u, table.GetCount());
+
+    table.Remove(handle1);
+    ASSERT_EQ(nullptr, table.Get(handle1));
+    ASSERT_EQ(0u, table.GetCount());
+
+    // The slot is used again, but the old handle doesn't find the new pin
+    auto handle2 = table.Add(pin2);
+    ASSERT_EQ(handle1.GetIndex(), handle2.GetIndex());
+    ASSERT_NE(handle1, handle2);
+    ASSERT_EQ(nullptr, table.Get(handle1));
+    ASSERT_EQ(pin2, table.Get(handle2));
+
+    // Removing through a stale handle does nothing
+    table.Remove(handle1);
+    ASSERT_EQ(pin2, table.Get(handle2));
+}
+
+TEST(PinTableTest, RemovedGate)
+{
+    Game game;
+
+    auto gate1 = std::make_shared<OrLogicGate>(&game);
+    auto gate2 = std::make_shared<OrLogicGate>(&game);
+    ASSERT_EQ(6u, game.GetPinTable().GetCount());
+
+    auto& output = gate1->GetOutputPins()[0];
+    auto& input = gate2->GetPinInputs()[0];
+    input->Catch(output.get(), input->GetAbsoluteLocation());
+    ASSERT_EQ(output.get(), input->GetLine());
+
+    // Once the gate with the output is gone, the input isn't connected to anything
+    gate1.reset();
+    ASSERT_EQ(3u, game.GetPinTable().GetCount());
+    ASSERT_EQ(nullptr, input->GetLine());
+}
@@ -0,0 +1,126 @@
+/**
+ * @file ProductGeneratorTest.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <wx/filename.h>
+#include <wx/file.h>
+#include <Game.h>
+#include <Conveyor.h>
+#include <Product.h>
+#include <ItemVisitor.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+/// A level with only a conveyor that makes its own products
+const wxString GeneratorLevel =
+    L"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+    L"<level size=\"1150,800\">"
+    L"<items>"
+    L"<conveyor x=\"150\" y=\"400\" speed=\"100\" height=\"800\" panel=\"60,-390\">"
+    L"<generator seed=\"335\" spacing=\"150\" placement=\"100\" count=\"%d\" kick=\"red\">"
+    L"<property name=\"square\" weight=\"2\"/><property name=\"circle\"/>"
+    L"<property name=\"red\"/><property name=\"green\"/>"
+    L"<property name=\"izzo\"/><property name=\"none\" weight=\"3\"/>"
+    L"</generator>"
+    L"</conveyor>"
+    L"</items>"
+    L"</level>";
+
+/**
+ * Visitor that starts every conveyor and collects the products
+ */
+class GeneratorTestVisitor : public ItemVisitor
+{
+public:
+    vector<Product*> mProducts; ///< The products visited
+
+    /**
+     * Start the conveyor
+     * @param conveyor Conveyor to start
+     */
+    void VisitConveyor(Conveyor* conveyor) override
+    {
+        if (!conveyor->GetStarted())
+        {
+            conveyor->Start();
+        }
+    }
+
+    /**
+     * Collect the product
+     * @param product Product to collect
+     */
+    void VisitProduct(Product* product) override { mProducts.push_back(product); }
+};
+
+/**
+ * Load the generator level into a game
+ * @param game Game to load into
+ * @param count Number of products the generator makes, 0 for no limit
+ */
+static void LoadGeneratorLevel(Game& game, int count)
+{
+    auto filename = wxFileName::GetTempDir() + L"/generator-level.xml";
+    wxFile file(filename, wxFile::write);
+    file.Write(wxString::Format(GeneratorLevel, count));
+    file.Close();
+
+    game.LoadLevel(filename);
+    wxRemoveFile(filename);
+}
+
+TEST(ProductGeneratorTest, Endless)
+{
+    Game game;
+    LoadGeneratorLevel(game, 0);
+
+    GeneratorTestVisitor start;
+    game.Accept(&start);
+    size_t productCount = start.mProducts.size();
+    ASSERT_GT(productCount, 0u);
+
+    // Run long enough for every product to go around many times
+    for (int i = 0; i < 1000; i++)
+    {
+        game.Update(0.1);
+    }
+
+    GeneratorTestVisitor visitor;
+    game.Accept(&visitor);
+    ASSERT_EQ(productCount, visitor.mProducts.size());
+
+    // Every product is still on the conveyor or waiting above it
+    for (auto product : visitor.mProducts)
+    {
+        ASSERT_LE(product->GetBounds().m_y, 800.0 + 10);
+    }
+}
+
+TEST(ProductGeneratorTest, Count)
+{
+    Game game;
+    LoadGeneratorLevel(game, 3);
+
+    GeneratorTestVisitor visitor;
+    game.Accept(&visitor);
+    ASSERT_EQ(3u, visitor.mProducts.size());
+
+    // The same seed makes the same products
+    Game other;
+    LoadGeneratorLevel(other, 3);
+
+    GeneratorTestVisitor otherVisitor;
+    other.Accept(&otherVisitor);
+    for (size_t i = 0; i < visitor.mProducts.size(); i++)
+    {
+        ASSERT_EQ(visitor.mProducts[i]->GetShape(), otherVisitor.mProducts[i]->GetShape());
+        ASSERT_EQ(visitor.mProducts[i]->GetColor(), otherVisitor.mProducts[i]->GetColor());
+        ASSERT_EQ(visitor.mProducts[i]->GetContent(), otherVisitor.mProducts[i]->GetContent());
+    }
+}
@@ -0,0 +1,35 @@
+/**
+ * @file ProductPoolTest.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <Game.h>
+#include <ProductPool.h>
+
+TEST(ProductPoolTest, Reuse)
+{
+    // Loading the same level again reuses the products of the last load
+    Game game;
+    game.LoadLevel(L"resources/levels/level3.xml");
+    size_t allocations = ProductPool::GetHeapAllocations();
+
+    for (int i = 0; i < 5; i++)
+    {
+        game.LoadLevel(L"resources/levels/level3.xml");
+    }
+
+    ASSERT_EQ(allocations, ProductPool::GetHeapAllocations());
+
+    // A released product's memory goes to the next one
+    auto product = ProductPool::Make(&game, Product::Properties::Square, Product::Properties::Red,
+                                     Product::Properties::None, false);
+    Product* released = product.get();
+    product = nullptr;
+
+    product = ProductPool::Make(&game, Product::Properties::Circle, Product::Properties::Blue,
+                                Product::Properties::None, true);
+    ASSERT_EQ(released, product.get());
+    ASSERT_EQ(Product::Properties::Circle, product->GetShape());
+}
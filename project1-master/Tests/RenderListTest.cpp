@@ -0,0 +1,79 @@
+/**
+ * @file RenderListTest.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <RenderList.h>
+
+TEST(RenderListTest, Record)
+{
+    RenderList list;
+    ASSERT_EQ(0, list.GetCount());
+
+    list.DrawRectangle(0, 0, 10, 10, *wxRED, *wxRED);
+    list.DrawEllipse(10, 10, 10, 10, *wxBLUE, *wxBLUE);
+    list.StrokeLine(0, 0, 20, 20, *wxBLACK, 3);
+    ASSERT_EQ(3, list.GetCount());
+
+    list.Clear();
+    ASSERT_EQ(0, list.GetCount());
+}
+
+TEST(RenderListTest, Replay)
+{
+    wxImage image(40, 20);
+    image.SetRGB(wxRect(0, 0, 40, 20), 255, 255, 255);
+
+    RenderList list;
+    list.DrawRectangle(0, 0, 20, 20, *wxRED, *wxRED);
+    list.DrawRectangle(20, 0, 20, 20, *wxBLUE, *wxBLUE);
+
+    {
+        // The image is updated when the context is destroyed
+        auto graphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(image));
+        list.Replay(graphics.get());
+    }
+
+    // Commands are drawn in the colours they were recorded with
+    ASSERT_EQ(255, image.GetRed(10, 10));
+    ASSERT_EQ(0, image.GetBlue(10, 10));
+    ASSERT_EQ(0, image.GetRed(30, 10));
+    ASSERT_EQ(255, image.GetBlue(30, 10));
+}
+
+TEST(RenderListTest, Path)
+{
+    wxImage image(40, 20);
+    image.SetRGB(wxRect(0, 0, 40, 20), 255, 255, 255);
+
+    RenderList list;
+
+    // Segments are not commands until the path is drawn
+    list.MoveTo(wxPoint2DDouble(0, 0));
+    list.LineTo(wxPoint2DDouble(20, 0));
+    list.LineTo(wxPoint2DDouble(20, 20));
+    list.LineTo(wxPoint2DDouble(0, 20));
+    list.ClosePath();
+    ASSERT_EQ(0, list.GetCount());
+
+    list.FillPath(*wxRED, *wxRED);
+    ASSERT_EQ(1, list.GetCount());
+
+    // A second path only has the segments added after the first was drawn
+    list.Circle(30, 10, 8);
+    list.FillPath(*wxBLUE, *wxBLUE);
+    ASSERT_EQ(2, list.GetCount());
+
+    {
+        // The image is updated when the context is destroyed
+        auto graphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(image));
+        list.Replay(graphics.get());
+    }
+
+    ASSERT_EQ(255, image.GetRed(10, 10));
+    ASSERT_EQ(0, image.GetBlue(10, 10));
+    ASSERT_EQ(0, image.GetRed(30, 10));
+    ASSERT_EQ(255, image.GetBlue(30, 10));
+}
@@ -0,0 +1,131 @@
+/**
+ * @file RenderTest.cpp
+ * @author Conner O'Sullivan
+ *
+ * Draws every level without a window and compares it against golden images
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <wx/filename.h>
+#include <Game.h>
+
+#include <cstdlib>
+
+using namespace std;
+
+/// Directory the golden images are kept in, in the source tree so they are committed with it
+const wxString GoldenDirectory = wxString::FromUTF8(GOLDEN_DIRECTORY);
+
+/// Set this environment variable to record the golden images that are missing
+const wxString RecordVariable = L"SPARTYBOOTS_RECORD_GOLDEN";
+
+/// Set this environment variable to fail instead of skip when golden images are missing
+const wxString RequireVariable = L"SPARTYBOOTS_REQUIRE_GOLDEN";
+
+/// Number of the last level
+const int LastLevel = 8;
+
+/// Sizes each level is drawn at
+const wxSize RenderSizes[] = {wxSize(1150, 800), wxSize(800, 600)};
+
+/// How far a channel can be from the golden image before the pixel counts as different
+const int ChannelTolerance = 16;
+
+/// Fraction of the pixels that can differ from the golden image
+const double DifferentPixelFraction = 0.005;
+
+/**
+ * Count the pixels that differ between two images of the same size
+ * @param image The drawn image
+ * @param golden The golden image
+ * @return Number of pixels with a channel further than ChannelTolerance from the golden image
+ */
+static int CountDifferentPixels(const wxImage& image, const wxImage& golden)
+{
+    int different = 0;
+    const unsigned char* a = image.GetData();
+    const unsigned char* b = golden.GetData();
+    size_t pixels = (size_t)image.GetWidth() * image.GetHeight();
+    for (size_t i = 0; i < pixels; i++, a += 3, b += 3)
+    {
+        if (abs(a[0] - b[0]) > ChannelTolerance || abs(a[1] - b[1]) > ChannelTolerance ||
+            abs(a[2] - b[2]) > ChannelTolerance)
+        {
+            different++;
+        }
+    }
+
+    return different;
+}
+
+/**
+ * Draw every level at each size and compare against the golden image.
+ *
+ * Golden images depend on the platform's fonts and antialiasing, so
+ * they are recorded on the platform the tests run on in CI. Running
+ * the tests with SPARTYBOOTS_RECORD_GOLDEN set records the missing
+ * ones from the drawing, to be checked by eye and committed. Levels
+ * without a golden image are still drawn, and the test is skipped
+ * rather than passed, unless SPARTYBOOTS_REQUIRE_GOLDEN is set to
+ * make a missing image fail.
+ */
+TEST(RenderTest, Levels)
+{
+    bool record = wxGetEnv(RecordVariable, nullptr);
+    bool require = wxGetEnv(RequireVariable, nullptr);
+
+    int missing = 0;
+
+    for (int level = 0; level <= LastLevel; level++)
+    {
+        for (const auto& size : RenderSizes)
+        {
+            auto name = wxString::Format(L"level%d-%dx%d", level, size.GetWidth(), size.GetHeight());
+            SCOPED_TRACE(name.ToStdString());
+
+            Game game;
+            game.SetLevelNum(level);
+            game.LoadLevel(wxString::Format(L"resources/levels/level%d.xml", level));
+
+            auto image = game.RenderImage(size.GetWidth(), size.GetHeight());
+            ASSERT_EQ(size.GetWidth(), image.GetWidth());
+            ASSERT_EQ(size.GetHeight(), image.GetHeight());
+
+            auto goldenFile = GoldenDirectory + name + L".png";
+            if (!wxFileExists(goldenFile))
+            {
+                if (!record)
+                {
+                    ASSERT_FALSE(require) << "Missing golden image " << goldenFile
+                                          << ", set " << RecordVariable << " to record it";
+                    missing++;
+                    continue;
+                }
+
+                wxFileName::Mkdir(GoldenDirectory, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+                ASSERT_TRUE(image.SaveFile(goldenFile, wxBITMAP_TYPE_PNG));
+                cout << "Recorded golden image " << goldenFile << endl;
+            }
+            else
+            {
+                wxImage golden(goldenFile, wxBITMAP_TYPE_PNG);
+                ASSERT_TRUE(golden.IsOk());
+                ASSERT_EQ(golden.GetSize(), image.GetSize());
+
+                int different = CountDifferentPixels(image, golden);
+                if (different > DifferentPixelFraction * image.GetWidth() * image.GetHeight())
+                {
+                    // Keep what we drew so the difference can be looked at
+                    image.SaveFile(GoldenDirectory + name + L".actual.png", wxBITMAP_TYPE_PNG);
+                    FAIL() << different << " pixels differ from " << goldenFile;
+                }
+            }
+        }
+    }
+
+    if (missing > 0)
+    {
+        GTEST_SKIP() << missing << " golden images are missing, set " << RecordVariable << " to record them";
+    }
+}
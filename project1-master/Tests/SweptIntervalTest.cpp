@@ -0,0 +1,46 @@
+/**
+ * @file SweptIntervalTest.cpp
+ * @author Mehrshad Bagherebadian
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <SweptInterval.h>
+
+TEST(SweptIntervalTest, Stationary)
+{
+    // Overlapping the whole tick
+    auto inside = SweptInterval::Sweep(0, 10, 0, 10, 5, 5);
+    ASSERT_FALSE(inside.IsEmpty());
+    ASSERT_FALSE(inside.Entered());
+    ASSERT_FALSE(inside.Exited());
+
+    // Never overlapping
+    auto outside = SweptInterval::Sweep(0, 10, 0, 10, 20, 30);
+    ASSERT_TRUE(outside.IsEmpty());
+}
+
+TEST(SweptIntervalTest, JumpOver)
+{
+    // A span that starts above a thin window and ends below it in one tick
+    auto interval = SweptInterval::Sweep(0, 10, 100, 110, 50, 50);
+    ASSERT_FALSE(interval.IsEmpty());
+    ASSERT_TRUE(interval.Entered());
+    ASSERT_TRUE(interval.Exited());
+    ASSERT_NEAR(0.4, interval.GetEnter(), 0.0001);
+    ASSERT_NEAR(0.5, interval.GetExit(), 0.0001);
+}
+
+TEST(SweptIntervalTest, Intersect)
+{
+    // Overlaps the first window for the first half of the tick, the second only after that
+    auto interval = SweptInterval::Sweep(0, 10, 100, 110, 0, 50);
+    interval.Intersect(SweptInterval::Sweep(0, 10, 100, 110, 70, 200));
+    ASSERT_TRUE(interval.IsEmpty());
+
+    auto overlap = SweptInterval::Sweep(0, 10, 100, 110, 0, 50);
+    overlap.Intersect(SweptInterval::Sweep(0, 10, 100, 110, 30, 200));
+    ASSERT_FALSE(overlap.IsEmpty());
+    ASSERT_NEAR(0.2, overlap.GetEnter(), 0.0001);
+    ASSERT_NEAR(0.5, overlap.GetExit(), 0.0001);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file WireTableTest.cpp
+ * @author Conner O'Sullivan
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <WireTable.h>
+
+#include <vector>
+
+using namespace std;
+
+/**
+ * Get the input pins an output pin has caught as a vector
+ * @param wires The wire table
+ * @param output The output pin
+ * @return The caught input pins
+ */
+static vector<PinHandle> GetCaught(WireTable& wires, PinHandle output)
+{
+    auto caught = wires.GetCaught(output);
+    return vector<PinHandle>(caught.begin(), caught.end());
+}
+
+TEST(WireTableTest, FanOut)
+{
+    WireTable wires;
+
+    PinHandle output1(3, 1);
+    PinHandle output2(1, 1);
+    PinHandle input1(2, 1);
+    PinHandle input2(4, 1);
+    PinHandle input3(5, 1);
+
+    ASSERT_TRUE(wires.GetCaught(output1).empty());
+
+    wires.Add(output1, input1);
+    wires.Add(output2, input2);
+    wires.Add(output1, input3);
+    ASSERT_EQ(3u, wires.GetCount());
+
+    // Each output pin's caught pins stay in the order they were caught
+    ASSERT_EQ(vector<PinHandle>({input1, input3}), GetCaught(wires, output1));
+    ASSERT_EQ(vector<PinHandle>({input2}), GetCaught(wires, output2));
+    ASSERT_TRUE(wires.GetCaught(input1).empty());
+    ASSERT_TRUE(wires.GetCaught(PinHandle()).empty());
+
+    wires.Remove(output1, input1);
+    ASSERT_EQ(vector<PinHandle>({input3}), GetCaught(wires, output1));
+
+    // Removing a pin removes the wires to and from it
+    wires.Add(output2, input3);
+    wires.RemovePin(input3);
+    ASSERT_TRUE(wires.GetCaught(output1).empty());
+    ASSERT_EQ(vector<PinHandle>({input2}), GetCaught(wires, output2));
+
+    wires.RemovePin(output2);
+    ASSERT_TRUE(wires.GetCaught(output2).empty());
+    ASSERT_EQ(0u, wires.GetCount());
+}
+
+TEST(WireTableTest, Version)
+{
+    WireTable wires;
+
+    PinHandle output(1, 1);
+    PinHandle input(2, 1);
+
+    // Every change to the wires is a new version, reading is not
+    auto version = wires.GetVersion();
+    wires.Add(output, input);
+    ASSERT_NE(version, wires.GetVersion());
+
+    version = wires.GetVersion();
+    wires.GetCaught(output);
+    ASSERT_EQ(version, wires.GetVersion());
+
+    wires.Remove(output, input);
+    ASSERT_NE(version, wires.GetVersion());
+
+    // Removing a wire that isn't there changes nothing
+    version = wires.GetVersion();
+    wires.Remove(output, input);
+    wires.RemovePin(input);
+    ASSERT_EQ(version, wires.GetVersion());
+}